@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+    BlockRamp.h
+    Block-rate evaluation of per-sample one-pole parameter smoothing.
+    - Settled values are snapped to their target and stay constant for the block
+    - Moving values get their whole trajectory written to a contiguous ramp
+      (closed form, so the fill vectorizes) and are read back per sample
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+template <int NumValues>
+class BlockRampBank
+{
+public:
+    static_assert(NumValues > 0 && NumValues <= 32, "moving mask is 32 bits");
+
+    static constexpr std::uint32_t allValues = (NumValues == 32) ? 0xffffffffu : ((1u << NumValues) - 1u);
+
+    // Allocates; call from prepare() only. alpha is the per-sample one-pole coefficient.
+    void prepare(int maxBlockSamples, double alpha)
+    {
+        max_block = maxBlockSamples > 0 ? maxBlockSamples : 1;
+        ramps.assign((size_t)NumValues * (size_t)max_block, 0.0);
+
+        // decay[i] = alpha^(i + 1): value after i + 1 steps of current += (target - current) * (1 - alpha)
+        decay.resize((size_t)max_block);
+        double p = 1.0;
+        for (auto& d : decay) { p *= alpha; d = p; }
+    }
+
+    // Starts a block of n samples for the values selected by `which`. Returns the mask of values
+    // still moving; everything else has been snapped to its target and can be read as a constant.
+    std::uint32_t begin(double* const* values, const double* targets, std::uint32_t which, int n) noexcept
+    {
+        moving = 0;
+        if (n > max_block) n = max_block;
+
+        for (int k = 0; k < NumValues; ++k)
+        {
+            if ((which & (1u << k)) == 0)
+                continue;
+
+            double& v = *values[k];
+            const double t = targets[k];
+            const double d = v - t;
+
+            if (std::abs(d) <= settleTolerance * (1.0 + std::abs(t)))
+            {
+                v = t;
+                continue;
+            }
+
+            double* out = ramps.data() + (size_t)k * (size_t)max_block;
+            const double* dec = decay.data();
+            for (int i = 0; i < n; ++i)
+                out[i] = t + d * dec[i];
+
+            moving |= 1u << k;
+        }
+
+        return moving;
+    }
+
+    // Values still moving in the current block (as returned by begin()).
+    std::uint32_t movingMask() const noexcept { return moving; }
+
+    // The current block's trajectory for value k, or nullptr if it is settled (read the value itself).
+    const double* ramp(int k) const noexcept
+    {
+        return ((moving >> k) & 1u) != 0 ? ramps.data() + (size_t)k * (size_t)max_block : nullptr;
+    }
+
+    // Per sample: copy the moving values' ramp entries into place.
+    inline void load(double* const* values, int i) const noexcept
+    {
+        for (std::uint32_t m = moving; m != 0; m &= m - 1)
+        {
+            const int k = lowestBit(m);
+            *values[k] = ramps[(size_t)k * (size_t)max_block + (size_t)i];
+        }
+    }
+
+private:
+    // Relative distance at which a glide counts as arrived (~-180 dB, far below anything audible).
+    static constexpr double settleTolerance = 1.0e-9;
+
+    static inline int lowestBit(std::uint32_t m) noexcept
+    {
+        int k = 0;
+        while ((m & 1u) == 0) { m >>= 1; ++k; }
+        return k;
+    }
+
+    std::vector<double> ramps;
+    std::vector<double> decay;
+    int max_block = 1;
+    std::uint32_t moving = 0;
+};
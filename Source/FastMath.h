@@ -0,0 +1,146 @@
+/*
+  ==============================================================================
+    FastMath.h
+    dB / linear conversions for the per-sample detector and gain paths.
+    - log2 / exp2 from the IEEE-754 exponent plus a short polynomial on the mantissa
+    - Branch-free integer / double arithmetic only, so loops over them can vectorize
+      (64-bit adds and logical shifts; no float <-> int64 conversions)
+    - Accuracy is a template argument; nothing here relies on -ffast-math, and the
+      rounding trick in exp2 actually requires strict IEEE evaluation
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+namespace MixBusMath
+{
+    // Accuracy contract, as measured worst-case error of linToDb / dbToLin (in dB)
+    // over -200..+40 dB:
+    //   Exact: std::log10 / std::pow
+    //   High:  < 1e-8 dB  (default for the DSP)
+    //   Fast:  < 5e-5 dB
+    enum class Accuracy { Exact, High, Fast };
+
+    namespace Detail
+    {
+        inline std::uint64_t bitsOf(double x) noexcept { std::uint64_t b; std::memcpy(&b, &x, sizeof(b)); return b; }
+        inline double fromBits(std::uint64_t b) noexcept { double x; std::memcpy(&x, &b, sizeof(x)); return x; }
+
+        // max(x, floor) for floor > 0, done on the bit patterns: non-negative doubles order like
+        // their bits as int64, and negative ones come out below any positive floor.
+        inline double floorPositive(double x, double floor) noexcept
+        {
+            const auto xb = (std::int64_t)bitsOf(x);
+            const auto fb = (std::int64_t)bitsOf(floor);
+            return fromBits((std::uint64_t)(xb > fb ? xb : fb));
+        }
+
+        constexpr double ln2 = 0.69314718055994530942;
+        constexpr double log2e = 1.44269504088896340736;
+
+        // Rounding constant for exp2: adding 1.5 * 2^52 pushes the fraction out of the mantissa
+        // and leaves the nearest integer in the low bits.
+        constexpr double exp2Shifter = 6755399441055744.0;
+
+        // Polynomial cores, shared with the 2-lane versions in MixBusSimd.h (V = double or Double2).
+        // log2(m) = 2 / ln2 * atanh(t) for t = (m - 1) / (m + 1); returns the series times t.
+        template <Accuracy A, typename V>
+        inline V log2Series(V t) noexcept
+        {
+            const V t2 = t * t;
+            V p;
+            if constexpr (A == Accuracy::High)
+                p = 1.0 + t2 * (1.0 / 3.0 + t2 * (1.0 / 5.0 + t2 * (1.0 / 7.0 + t2 * (1.0 / 9.0))));
+            else
+                p = 1.0 + t2 * (1.0 / 3.0 + t2 * (1.0 / 5.0));
+            return (2.0 * log2e) * t * p;
+        }
+
+        // e^y for |y| <= ln2 / 2
+        template <Accuracy A, typename V>
+        inline V expSeries(V y) noexcept
+        {
+            if constexpr (A == Accuracy::High)
+                return 1.0 + y * (1.0 + y * (1.0 / 2.0 + y * (1.0 / 6.0 + y * (1.0 / 24.0 + y * (1.0 / 120.0
+                         + y * (1.0 / 720.0 + y * (1.0 / 5040.0 + y * (1.0 / 40320.0))))))));
+            else
+                return 1.0 + y * (1.0 + y * (1.0 / 2.0 + y * (1.0 / 6.0 + y * (1.0 / 24.0 + y * (1.0 / 120.0)))));
+        }
+    }
+
+    // log2 of a positive, normal, finite x.
+    template <Accuracy A = Accuracy::High>
+    inline double log2(double x) noexcept
+    {
+        if constexpr (A == Accuracy::Exact)
+        {
+            return std::log2(x);
+        }
+        else
+        {
+            using namespace Detail;
+
+            // Split x = 2^k * m with m in [sqrt(1/2), sqrt(2)): biasing the bits by the distance from
+            // sqrt(1/2) to 1.0 makes the exponent field round at sqrt(2) instead of at 2.
+            constexpr std::uint64_t oneBits = 0x3ff0000000000000ull;
+            constexpr std::uint64_t bias = oneBits - 0x3fe6a09e667f3bcdull; // 1.0 - sqrt(1/2), in bits
+            constexpr std::uint64_t two52Bits = 0x4330000000000000ull;      // 2^52
+
+            const std::uint64_t bits = bitsOf(x);
+            const std::uint64_t kb = (bits + bias) >> 52;                    // k + 1023
+            const double m = fromBits(bits - (kb << 52) + oneBits);
+            const double k = fromBits(two52Bits | kb) - 4503599627370496.0 - 1023.0;
+
+            // |t| <= 0.1716 over the reduced mantissa range
+            return k + log2Series<A>((m - 1.0) / (m + 1.0));
+        }
+    }
+
+    // 2^x for x in [-1022, 1023] (not clamped: every caller is bounded far inside that range,
+    // and a floating-point select would stop the loop vectorizing under strict IEEE).
+    template <Accuracy A = Accuracy::High>
+    inline double exp2(double x) noexcept
+    {
+        if constexpr (A == Accuracy::Exact)
+        {
+            return std::exp2(x);
+        }
+        else
+        {
+            using namespace Detail;
+
+            const double shifted = x + exp2Shifter;
+            const double n = shifted - exp2Shifter;
+
+            const std::uint64_t nBits = bitsOf(shifted) - bitsOf(exp2Shifter); // n, two's complement
+            const double scale = fromBits((nBits + 1023u) << 52);
+
+            return expSeries<A>((x - n) * ln2) * scale;
+        }
+    }
+
+    // 20 * log10(lin), with lin floored at 1e-20 (-400 dB) as the detector always has.
+    template <Accuracy A = Accuracy::High>
+    inline double linToDb(double lin) noexcept
+    {
+        if constexpr (A == Accuracy::Exact)
+            return 20.0 * std::log10(std::max(lin, 1.0e-20));
+        else
+            return 6.0205999132796239 * log2<A>(Detail::floorPositive(lin, 1.0e-20)); // 20 * log10(2)
+    }
+
+    // 10^(db / 20). 0 dB maps to exactly 1.0 at every accuracy.
+    template <Accuracy A = Accuracy::High>
+    inline double dbToLin(double db) noexcept
+    {
+        if constexpr (A == Accuracy::Exact)
+            return std::pow(10.0, db / 20.0);
+        else
+            return exp2<A>(db * 0.16609640474436811); // log2(10) / 20
+    }
+}
@@ -0,0 +1,211 @@
+/*
+  ==============================================================================
+    FilterDesignStage.h
+    Off-audio-thread design of the automatable filter curves.
+    - TripleBuffer: wait-free single-producer / single-consumer handoff
+    - FilterDesignStage: audio thread posts design inputs, a worker publishes
+      finished coefficient sets back (the audio thread only swaps and ramps)
+    - FilterDesignThread: one shared worker for every plugin instance
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <cstdint>
+#include "SimpleBiquad.h"
+
+// ==============================================================================
+// TRIPLE BUFFER
+// The writer fills writeBuffer() and publish()es it; the reader calls fetch() and,
+// when it returns true, reads readBuffer(). Neither side ever blocks or retries:
+// each operation is a single atomic exchange on the shared "middle" slot index.
+// ==============================================================================
+template <typename T>
+class TripleBuffer
+{
+public:
+    T& writeBuffer() noexcept { return slots[back]; }
+
+    void publish() noexcept
+    {
+        back = middle.exchange(back | freshBit, std::memory_order_acq_rel) & indexMask;
+    }
+
+    bool fetch() noexcept
+    {
+        if ((middle.load(std::memory_order_relaxed) & freshBit) == 0)
+            return false;
+
+        front = middle.exchange(front, std::memory_order_acq_rel) & indexMask;
+        return true;
+    }
+
+    const T& readBuffer() const noexcept { return slots[front]; }
+
+private:
+    static constexpr int indexMask = 3;
+    static constexpr int freshBit = 4;
+
+    T slots[3]{};
+    int back = 0;                 // writer only
+    int front = 2;                // reader only
+    std::atomic<int> middle{ 1 }; // slot index | freshBit
+};
+
+// ==============================================================================
+// FILTER DESIGN STAGE
+// ==============================================================================
+class FilterDesignStage : public juce::TimeSliceClient
+{
+public:
+    // Curves that follow continuous automation. Thrust (a 3-way choice) and the fixed
+    // voicing curves stay on the audio thread.
+    enum Slot
+    {
+        ScHp = 0,
+        ScLp,
+        SatTone,
+        GirthBump,
+        GirthDip,
+        HarmPre,
+        HarmPost,
+        NumSlots
+    };
+
+    struct Request
+    {
+        double sampleRate = 44100.0;
+        double osSampleRate = 176400.0;
+        float sc_hp_freq = 20.0f;
+        float sc_lp_freq = 20000.0f;
+        float sat_tone = 0.0f;
+        float sat_tone_freq = 10000.0f;
+        float girth = 0.0f;
+        int   girth_freq_sel = 0;
+        float harm_bright = 0.0f;
+        float harm_freq = 10000.0f;
+        std::uint32_t serial = 0;
+    };
+
+    struct CoefficientSet
+    {
+        SimpleBiquad::Coeffs c[NumSlots];
+        std::uint32_t serial = 0;
+    };
+
+    // Bit per slot, for partial synchronous designs.
+    static constexpr std::uint32_t slotBit(Slot s) noexcept { return 1u << (std::uint32_t)s; }
+    static constexpr std::uint32_t allSlots = (1u << NumSlots) - 1u;
+
+    // Same curves UltimateCompDSP used to design inline; shared by the worker and the synchronous path.
+    // Controls at their off positions (SC HPF fully down, 0 dB Tone / Girth / Harm) design the
+    // exact identity (SimpleBiquad::makeIdentity), which the chains elide. The SC LPF has no such
+    // position: at 20 kHz it is still a real filter (clamped below Nyquist).
+    static constexpr float scHpOffHz = 1.0f;
+
+    static void design(const Request& r, CoefficientSet& out, std::uint32_t slots = allSlots) noexcept
+    {
+        SimpleBiquad bq;
+
+        if (slots & slotBit(ScHp))
+        {
+            bq.update_hpf((double)r.sc_hp_freq, 0.707, r.sampleRate);
+            if (r.sc_hp_freq <= scHpOffHz) bq.makeIdentity();
+            out.c[ScHp] = bq.getCoeffs();
+        }
+
+        if (slots & slotBit(ScLp))
+        {
+            bq.update_lpf(std::max(40.0, (double)r.sc_lp_freq), 0.707, r.sampleRate);
+            out.c[ScLp] = bq.getCoeffs();
+        }
+
+        if (slots & slotBit(SatTone))
+        {
+            bq.update_shelf((double)r.sat_tone_freq, (double)r.sat_tone, 0.707, r.sampleRate);
+            if (r.sat_tone == 0.0f) bq.makeIdentity();
+            out.c[SatTone] = bq.getCoeffs();
+        }
+
+        // --- PULTEC-STYLE LOW-END TRICK (TUNED) ---
+        if (slots & (slotBit(GirthBump) | slotBit(GirthDip)))
+        {
+            const int idx = juce::jlimit(0, 3, r.girth_freq_sel);
+            static const double freqs[4] = { 20.0, 30.0, 60.0, 100.0 };
+            static const double dips[4] = { 65.0, 97.5, 195.0, 325.0 };
+
+            const double f0 = freqs[idx];
+            const double fd = dips[idx];
+
+            const double bumpQ = 1.0;
+            const double dipQ = 0.6;
+
+            const double bumpDb = (double)r.girth;
+            const double dipDb = -(double)r.girth * 0.80;
+
+            bq.update_low_shelf(f0 * 4.0, bumpDb, bumpQ, r.sampleRate);
+            if (r.girth == 0.0f) bq.makeIdentity();
+            out.c[GirthBump] = bq.getCoeffs();
+            bq.update_peak(fd, dipDb, dipQ, r.sampleRate);
+            if (r.girth == 0.0f) bq.makeIdentity();
+            out.c[GirthDip] = bq.getCoeffs();
+        }
+
+        if (slots & (slotBit(HarmPre) | slotBit(HarmPost)))
+        {
+            const double hb = (double)r.harm_bright;
+            bq.update_shelf((double)r.harm_freq, -hb, 0.707, r.osSampleRate);
+            if (hb == 0.0) bq.makeIdentity();
+            out.c[HarmPre] = bq.getCoeffs();
+            bq.update_shelf((double)r.harm_freq, hb, 0.707, r.osSampleRate);
+            if (hb == 0.0) bq.makeIdentity();
+            out.c[HarmPost] = bq.getCoeffs();
+        }
+
+        out.serial = r.serial;
+    }
+
+    // --- AUDIO THREAD ---
+    void post(const Request& r) noexcept
+    {
+        requests.writeBuffer() = r;
+        requests.publish();
+    }
+
+    // Returns the newest finished set, or nullptr when nothing new arrived since the last call.
+    const CoefficientSet* poll() noexcept
+    {
+        return results.fetch() ? &results.readBuffer() : nullptr;
+    }
+
+    // --- WORKER ---
+    int useTimeSlice() override
+    {
+        if (!requests.fetch())
+            return idlePollMs;
+
+        design(requests.readBuffer(), results.writeBuffer());
+        results.publish();
+        return 0; // check again straight away, automation tends to arrive in bursts
+    }
+
+private:
+    static constexpr int idlePollMs = 2;
+
+    TripleBuffer<Request> requests;
+    TripleBuffer<CoefficientSet> results;
+};
+
+// ==============================================================================
+// SHARED WORKER
+// One background thread serves every FilterDesignStage in the process
+// (use through juce::SharedResourcePointer).
+// ==============================================================================
+class FilterDesignThread : public juce::TimeSliceThread
+{
+public:
+    FilterDesignThread() : juce::TimeSliceThread("MixBus Filter Design") { startThread(); }
+    ~FilterDesignThread() override { stopThread(1000); }
+};
@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+    FixedVoicingCurves.h
+    Filter curves that depend on nothing but the sample rate:
+    - Iron voicing shelf, Steel low shelf / 9 kHz LPF
+    - The fixed Mojo chain (20 Hz HPF, 80 Hz shelf, 320 Hz dip, 8 kHz shelf, 18 kHz LPF)
+    Designed once per sample rate and shared by every instance; only prepare() reads them.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "SimpleBiquad.h"
+
+struct FixedVoicingCurves
+{
+    enum Curve
+    {
+        IronVoicing = 0,
+        SteelLow,
+        SteelHigh,
+        MojoHp,
+        MojoLowShelf,
+        MojoDip,
+        MojoHiShelf,
+        MojoLp,
+        NumCurves
+    };
+
+    double sampleRate = 0.0;
+    SimpleBiquad::Coeffs c[NumCurves];
+
+    static FixedVoicingCurves design(double sr)
+    {
+        FixedVoicingCurves f;
+        f.sampleRate = sr;
+
+        SimpleBiquad bq;
+        bq.update_shelf(100.0, 1.0, 0.707, sr);        f.c[IronVoicing] = bq.getCoeffs();
+        bq.update_shelf(40.0, 1.5, 0.707, sr);         f.c[SteelLow] = bq.getCoeffs();
+        bq.update_lpf(9000.0, 0.707, sr);              f.c[SteelHigh] = bq.getCoeffs();
+
+        // MOJO PARAMETERS (Fixed "Analog" Curve)
+        bq.update_hpf(20.0, 0.707, sr);                f.c[MojoHp] = bq.getCoeffs();
+        bq.update_low_shelf(80.0, 2.0, 0.9, sr);       f.c[MojoLowShelf] = bq.getCoeffs(); // Thick
+        bq.update_peak(320.0, -1.5, 1.5, sr);          f.c[MojoDip] = bq.getCoeffs();      // Mud cut
+        bq.update_shelf(8000.0, 1.5, 0.707, sr);       f.c[MojoHiShelf] = bq.getCoeffs();  // Air
+        bq.update_lpf(18000.0, 0.707, sr);             f.c[MojoLp] = bq.getCoeffs();       // Smooth top
+
+        return f;
+    }
+};
+
+// ==============================================================================
+// SAMPLE-RATE-KEYED STORE
+// Hosts only ever run a handful of rates, so a short list beats a map. Lookups happen
+// in prepare() (never on the audio thread), which makes the lock harmless.
+// Use through juce::SharedResourcePointer.
+// ==============================================================================
+class FixedVoicingCurveStore
+{
+public:
+    FixedVoicingCurves get(double sampleRate)
+    {
+        const juce::ScopedLock sl(lock);
+
+        for (const auto& entry : entries)
+            if (entry.sampleRate == sampleRate)
+                return entry;
+
+        entries.push_back(FixedVoicingCurves::design(sampleRate));
+        return entries.back();
+    }
+
+private:
+    juce::CriticalSection lock;
+    std::vector<FixedVoicingCurves> entries;
+};
@@ -0,0 +1,187 @@
+/*
+  ==============================================================================
+    GainComputer.h
+    Static compressor curve (threshold / ratio / smoothstep soft knee).
+    - gainDb(): the reference curve, evaluated in dB
+    - GainComputerTable: the same curve tabulated against detector *level*, indexed
+      straight from the double's exponent / mantissa bits (no log10 per sample)
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace GainComputer
+{
+    // Gain reduction in dB (<= 0) for a detector level in dB.
+    // Note the knee is not continuous at +knee/2 (the in-knee branch reaches knee, the
+    // upper branch restarts at knee/2); that is the shipped voicing and is kept as is.
+    inline double gainDb(double det_db, double thresh_db, double ratio, double knee) noexcept
+    {
+        const double x = det_db - thresh_db;
+
+        if (knee > 0.0)
+        {
+            const double half = knee * 0.5;
+            if (x <= -half) return 0.0;
+            if (x >= half) return -(x - x / ratio);
+
+            const double t = (x + half) / knee; // 0..1
+            const double y = t * t * (3.0 - 2.0 * t); // smoothstep
+            const double x2 = x - (-half);
+            const double gr_full = -(x2 - x2 / ratio);
+            return gr_full * y;
+        }
+
+        return (x > 0.0) ? -(x - x / ratio) : 0.0;
+    }
+
+    inline double levelToDb(double lin) noexcept { return 20.0 * std::log10(std::max(lin, 1.0e-20)); }
+}
+
+// ==============================================================================
+// GAIN COMPUTER TABLE
+// Nodes sit at 2^octave * (1 + j / StepsPerOctave), so the segment index is the exponent
+// plus the top mantissa bits and the interpolation weight is the remaining mantissa.
+// The segments around the two knee edges fall back to the reference curve,
+// which keeps the hard-knee corner and the +knee/2 step exact.
+//
+// Max error vs gainDb() over -120..+24 dBFS, threshold -60..0, ratio 1..20, knee 0..24 dB
+// (outside the knee / inside it). In-knee error scales with ratio and 1 / knee width, so its
+// maximum sits at ratio 20 on the narrowest knee that is still interpolated (~16 segments):
+//    16 steps/octave   3 KB   3.8e-3 / 2.0e-2 dB
+//    32 steps/octave   6 KB   9.8e-4 / 8.7e-3 dB
+//    64 steps/octave  12 KB   2.5e-4 / 4.6e-3 dB
+//   128 steps/octave  24 KB   6.6e-5 / 2.3e-3 dB
+// ==============================================================================
+template <int StepsPerOctave>
+class GainComputerTable
+{
+public:
+    static_assert(StepsPerOctave >= 1 && StepsPerOctave <= 4096 && (StepsPerOctave & (StepsPerOctave - 1)) == 0,
+                  "steps per octave must be a power of two");
+
+    // Table span: below minOctave the curve is flat at 0 dB for every legal threshold / knee;
+    // above maxOctave (+48 dBFS) lookups fall back to the reference curve.
+    static constexpr int minOctave = -40;
+    static constexpr int maxOctave = 8;
+    static constexpr int numSegments = (maxOctave - minOctave) * StepsPerOctave;
+
+    GainComputerTable()
+    {
+        for (int j = 0; j <= StepsPerOctave; ++j)
+            mantissa_db[(size_t)j] = GainComputer::levelToDb(1.0 + (double)j / (double)StepsPerOctave);
+
+        gr.assign((size_t)numSegments + 1, 0.0f);
+    }
+
+    bool matches(double thresh_db, double ratio, double knee) const noexcept
+    {
+        return valid && thresh_db == curve_thresh && ratio == curve_ratio && knee == curve_knee;
+    }
+
+    // Rebuilds only when the curve changed. Allocation-free; ~numSegments polynomial evaluations.
+    void setCurve(double thresh_db, double ratio, double knee) noexcept
+    {
+        if (matches(thresh_db, ratio, knee))
+            return;
+
+        curve_thresh = thresh_db; curve_ratio = ratio; curve_knee = knee;
+
+        for (int s = 0; s <= numSegments; ++s)
+            gr[(size_t)s] = (float)GainComputer::gainDb(nodeDb(s), curve_thresh, curve_ratio, curve_knee);
+
+        // Segments that stay on the reference curve: each knee edge plus its neighbours (so rounding
+        // in the edge search never matters), or the whole knee when it is too narrow to interpolate.
+        const double half = curve_knee * 0.5;
+        const int lo = segmentForDb(curve_thresh - half);
+        const int hi = segmentForDb(curve_thresh + half);
+
+        if (hi - lo < minKneeSegments)
+        {
+            ref_a = lo - 1; ref_a_len = (unsigned)(hi - lo + 2);
+            ref_b = ref_a;  ref_b_len = ref_a_len;
+        }
+        else
+        {
+            ref_a = lo - 1; ref_a_len = 2u;
+            ref_b = hi - 1; ref_b_len = 2u;
+        }
+        valid = true;
+    }
+
+    // Gain reduction in dB for a detector level (>= 0), on the curve set by setCurve().
+    double gainDb(double level) const noexcept
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &level, sizeof(bits));
+
+        const int octave = (int)((bits >> 52) & 0x7ff) - 1023;
+        if (octave < minOctave)
+            return (double)gr[0];
+        if (octave >= maxOctave)
+            return reference(level);
+
+        const std::uint64_t mantissa = bits & ((std::uint64_t(1) << 52) - 1);
+        const int s = (octave - minOctave) * StepsPerOctave + (int)(mantissa >> fracBits);
+        if ((unsigned)(s - ref_a) <= ref_a_len || (unsigned)(s - ref_b) <= ref_b_len)
+            return reference(level);
+
+        const double w = (double)(mantissa & ((std::uint64_t(1) << fracBits) - 1)) * fracScale;
+        const double a = (double)gr[(size_t)s];
+        return a + ((double)gr[(size_t)s + 1] - a) * w;
+    }
+
+private:
+    static constexpr int log2Steps()
+    {
+        int b = 0;
+        while ((1 << b) < StepsPerOctave) ++b;
+        return b;
+    }
+
+    static constexpr int fracBits = 52 - log2Steps();
+    static constexpr double fracScale = 1.0 / (double)(std::uint64_t(1) << fracBits);
+
+    double reference(double level) const noexcept
+    {
+        return GainComputer::gainDb(GainComputer::levelToDb(level + 1e-20), curve_thresh, curve_ratio, curve_knee);
+    }
+
+    double nodeDb(int s) const noexcept
+    {
+        const int octave = s / StepsPerOctave;
+        const int j = s - octave * StepsPerOctave;
+        return (double)(octave + minOctave) * octaveDb + mantissa_db[(size_t)j];
+    }
+
+    int segmentForDb(double db) const noexcept
+    {
+        const double level = std::pow(10.0, db / 20.0);
+        const int octave = (int)std::floor(std::log2(level));
+        if (octave < minOctave || octave >= maxOctave)
+            return -8;
+
+        const double m = level / std::ldexp(1.0, octave) - 1.0;
+        const int j = std::min(StepsPerOctave - 1, std::max(0, (int)(m * (double)StepsPerOctave)));
+        return (octave - minOctave) * StepsPerOctave + j;
+    }
+
+    // Interpolation error inside the knee grows as 1 / knee width; below this many segments
+    // the knee is cheaper to keep exact than to tabulate.
+    static constexpr int minKneeSegments = 16;
+
+    static constexpr double octaveDb = 6.020599913279624; // 20 * log10(2)
+
+    double mantissa_db[StepsPerOctave + 1];
+    std::vector<float> gr;
+    double curve_thresh = 0.0, curve_ratio = 1.0, curve_knee = 0.0;
+    int ref_a = -3, ref_b = -3;
+    unsigned ref_a_len = 0, ref_b_len = 0;
+    bool valid = false;
+};
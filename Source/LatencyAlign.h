@@ -0,0 +1,112 @@
+/*
+  ==============================================================================
+    LatencyAlign.h
+    Aligns a parallel path with the oversampled Saturation path without running
+    the signal through a second oversampler.
+    - Timing: an integer delay of the oversampler's reported latency
+    - Matched: an FIR of the round trip's own impulse response (measured once in
+      prepare), for paths that are summed with the saturated signal, where a plain
+      delay would leave the half-band filters' phase behind as a comb near Nyquist
+    Allocation happens in prepare() only; setPath() swaps paths on the audio thread.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+class LatencyAligner
+{
+public:
+    // Longest response the matched mode keeps; anything after it is truncated.
+    static constexpr int maxTaps = 512;
+
+    // Relative level below which the tail of a measured response is dropped (-100 dB).
+    static constexpr float tailFloor = 1.0e-5f;
+
+    // Allocates for any path whose delay is at most maxDelaySamples; starts as a plain wire.
+    void prepare(int numChannels, int maxBlock, int maxDelaySamples)
+    {
+        channels = std::max(1, numChannels);
+        block = std::max(1, maxBlock);
+        capacity = std::max(maxTaps - 1, std::max(0, maxDelaySamples));
+        stride = capacity + block;
+        work.assign((size_t)channels * (size_t)stride, 0.0f);
+        taps.assign((size_t)maxTaps, 0.0f);
+        setPath(0, nullptr, 0);
+    }
+
+    // delaySamples is the timing delay; response / responseLength the path to match
+    // (first tap at lag 0), trimmed to maxTaps and its audible tail. Does not allocate;
+    // the history is cleared, as it belonged to the previous path.
+    void setPath(int delaySamples, const float* response, int responseLength) noexcept
+    {
+        delay = std::clamp(delaySamples, 0, capacity);
+
+        numTaps = 1;
+        taps[0] = 1.0f;
+        if (response != nullptr && responseLength > 0)
+        {
+            const int len = std::min(responseLength, maxTaps);
+            float peak = 0.0f;
+            for (int k = 0; k < len; ++k) peak = std::max(peak, std::abs(response[k]));
+
+            int last = 0;
+            for (int k = 0; k < len; ++k)
+                if (std::abs(response[k]) > peak * tailFloor) last = k;
+
+            std::copy(response, response + last + 1, taps.begin());
+            numTaps = last + 1;
+        }
+
+        history = std::max(numTaps - 1, delay);
+        reset();
+    }
+
+    void reset() noexcept { std::fill(work.begin(), work.end(), 0.0f); }
+
+    int getNumTaps() const noexcept { return numTaps; }
+
+    // In place on the first min(numCh, prepared) channels, n <= maxBlock. Both modes read
+    // the same input history, so a path can switch between them from one block to the next.
+    void process(float* const* x, int numCh, int n, bool matched) noexcept
+    {
+        const int count = std::min(numCh, channels);
+
+        for (int ch = 0; ch < count; ++ch)
+        {
+            float* w = work.data() + (size_t)ch * (size_t)stride;
+            float* y = x[ch];
+            std::memcpy(w + history, y, (size_t)n * sizeof(float));
+
+            if (matched)
+            {
+                // Tap-outer order: every output sums its taps in the same order, and the
+                // inner loop is a plain multiply-add over contiguous samples.
+                std::fill(y, y + n, 0.0f);
+                for (int k = 0; k < numTaps; ++k)
+                {
+                    const float h = taps[(size_t)k];
+                    const float* src = w + history - k;
+                    for (int i = 0; i < n; ++i)
+                        y[i] += h * src[i];
+                }
+            }
+            else
+            {
+                std::memcpy(y, w + history - delay, (size_t)n * sizeof(float));
+            }
+
+            std::memmove(w, w + n, (size_t)history * sizeof(float));
+        }
+    }
+
+private:
+    std::vector<float> taps;    // maxTaps slots, the first numTaps in use
+    std::vector<float> work;    // per channel: [history | block], history <= capacity
+    int channels = 1, block = 1, delay = 0;
+    int numTaps = 1, capacity = 0, history = 0, stride = 1;
+};
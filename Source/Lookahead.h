@@ -0,0 +1,141 @@
+/*
+  ==============================================================================
+    Lookahead.h
+    Building blocks for the compressor's lookahead mode.
+    - SlidingWindowMax: running maximum over the last W samples from a monotonic
+      deque, amortized O(1) per sample whatever the window length
+    - LookaheadDelay: integer-sample ring delay for the program channels
+    Both allocate in prepare() only.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// ==============================================================================
+// SLIDING WINDOW MAX
+// The deque holds the samples that can still become the window maximum: values strictly
+// decrease from front to back, so the front is the current maximum. A new sample evicts
+// every smaller one from the back, and the front leaves once it is W samples old. Each
+// sample is pushed and popped at most once.
+// ==============================================================================
+class SlidingWindowMax
+{
+public:
+    void prepare(int maxWindow)
+    {
+        capacity = std::max(1, maxWindow) + 1;
+        values.assign((size_t)capacity, 0.0);
+        stamps.assign((size_t)capacity, 0u);
+        window = 1;
+        reset();
+    }
+
+    // Takes effect from the next sample; callers reset() alongside so no stale entries linger.
+    void setWindow(int w) noexcept { window = (std::uint32_t)std::clamp(w, 1, capacity - 1); }
+
+    void reset() noexcept { head = 0; size = 0; now = 0; }
+
+    // Replaces x[i] (levels, >= 0) with the maximum over x[i - W + 1 .. i].
+    void process(double* x, int n) noexcept
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            const double v = x[i];
+
+            while (size > 0 && values[(size_t)slot(size - 1)] <= v)
+                --size;
+
+            const int back = slot(size++);
+            values[(size_t)back] = v;
+            stamps[(size_t)back] = now;
+
+            // Stamps are unique, so at most the front can have expired (wrap-safe unsigned age)
+            if (now - stamps[(size_t)head] >= window) {
+                head = slot(1);
+                --size;
+            }
+
+            ++now;
+            x[i] = values[(size_t)head];
+        }
+    }
+
+private:
+    int slot(int k) const noexcept
+    {
+        const int s = head + k;
+        return s >= capacity ? s - capacity : s;
+    }
+
+    std::vector<double> values;
+    std::vector<std::uint32_t> stamps;
+    int capacity = 2;
+    int head = 0, size = 0;
+    std::uint32_t window = 1;
+    std::uint32_t now = 0;
+};
+
+// ==============================================================================
+// LOOKAHEAD DELAY
+// Delays every channel by the same whole number of samples; all channels share one write
+// position, so they must be processed together, once per block.
+// ==============================================================================
+class LookaheadDelay
+{
+public:
+    void prepare(int numChannels, int maxDelay)
+    {
+        channels = std::max(1, numChannels);
+        length = std::max(0, maxDelay) + 1;
+        ring.assign((size_t)channels * (size_t)length, 0.0f);
+        delay = 0;
+        reset();
+    }
+
+    void setDelay(int samples) noexcept { delay = std::clamp(samples, 0, length - 1); }
+    int getDelay() const noexcept { return delay; }
+
+    void reset() noexcept
+    {
+        std::fill(ring.begin(), ring.end(), 0.0f);
+        pos = 0;
+    }
+
+    // In place, on the first min(numChannels, prepared) channels.
+    void process(float* const* x, int numChannels, int n) noexcept
+    {
+        if (delay == 0)
+            return;
+
+        const int numCh = std::min(numChannels, channels);
+        for (int ch = 0; ch < numCh; ++ch)
+        {
+            float* r = ring.data() + (size_t)ch * (size_t)length;
+            float* y = x[ch];
+            int w = pos;
+            int rd = pos - delay;
+            if (rd < 0) rd += length;
+
+            for (int i = 0; i < n; ++i)
+            {
+                r[w] = y[i];
+                y[i] = r[rd];
+                if (++w == length) w = 0;
+                if (++rd == length) rd = 0;
+            }
+        }
+
+        pos = (int)(((std::int64_t)pos + n) % length);
+    }
+
+private:
+    std::vector<float> ring;
+    int channels = 1;
+    int length = 1;
+    int delay = 0;
+    int pos = 0;
+};
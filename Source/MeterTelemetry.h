@@ -0,0 +1,145 @@
+/*
+  ==============================================================================
+    MeterTelemetry.h
+    Audio thread -> UI meter handoff.
+    - One MeterFrame per processBlock, published through a seqlock that sits on its
+      own cache line (the UI's acknowledgement lives on another one)
+    - Blocks are merged until the UI has read a frame, so short peaks (and GR dips)
+      between two UI refreshes are never lost
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+#include <cmath>
+
+struct MeterFrame
+{
+    float inPeak[2]  = { 0.0f, 0.0f };
+    float inRms[2]   = { 0.0f, 0.0f };
+    float outPeak[2] = { 0.0f, 0.0f };
+    float outRms[2]  = { 0.0f, 0.0f };
+    float grMin = 0.0f; // deepest gain reduction (dB, <= 0)
+    float grMax = 0.0f; // shallowest gain reduction (dB, <= 0)
+    float flux = 0.0f;  // peak flux saturation
+    float crest = 0.0f; // latest crest-factor amount
+
+    static constexpr int numValues = 12;
+};
+
+class MeterTelemetry
+{
+public:
+    // --- AUDIO THREAD ---
+    // Merges the block into whatever the UI has not collected yet, then publishes.
+    void publish(const MeterFrame& block) noexcept
+    {
+        const std::uint32_t seq = writer.sequence.load(std::memory_order_relaxed);
+        const bool collected = (reader.ackSequence.load(std::memory_order_relaxed) == seq);
+
+        if (collected || pendingBlocks == 0)
+        {
+            pending = block;
+            pendingBlocks = 1;
+        }
+        else
+        {
+            merge(pending, block, pendingBlocks);
+            ++pendingBlocks;
+        }
+
+        float values[MeterFrame::numValues];
+        flatten(pending, values);
+
+        writer.sequence.store(seq + 1, std::memory_order_relaxed); // odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        for (int i = 0; i < MeterFrame::numValues; ++i)
+            writer.values[i].store(values[i], std::memory_order_relaxed);
+        writer.sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    // --- UI THREAD ---
+    // Returns false if there is nothing new, or if the audio thread kept the frame busy;
+    // `out` is left untouched in that case.
+    bool read(MeterFrame& out) noexcept
+    {
+        for (int attempt = 0; attempt < maxReadAttempts; ++attempt)
+        {
+            const std::uint32_t s0 = writer.sequence.load(std::memory_order_acquire);
+            if ((s0 & 1u) != 0)
+                continue;
+            if (s0 == reader.ackSequence.load(std::memory_order_relaxed))
+                return false;
+
+            float values[MeterFrame::numValues];
+            for (int i = 0; i < MeterFrame::numValues; ++i)
+                values[i] = writer.values[i].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (writer.sequence.load(std::memory_order_relaxed) != s0)
+                continue;
+
+            unflatten(values, out);
+            reader.ackSequence.store(s0, std::memory_order_relaxed);
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    static constexpr int maxReadAttempts = 4;
+
+    static void merge(MeterFrame& acc, const MeterFrame& b, int accBlocks) noexcept
+    {
+        // RMS is merged as a running mean of squares, weighting every block equally.
+        const float w = 1.0f / (float)(accBlocks + 1);
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            acc.inPeak[ch] = std::max(acc.inPeak[ch], b.inPeak[ch]);
+            acc.outPeak[ch] = std::max(acc.outPeak[ch], b.outPeak[ch]);
+            acc.inRms[ch] = std::sqrt(acc.inRms[ch] * acc.inRms[ch] * (1.0f - w) + b.inRms[ch] * b.inRms[ch] * w);
+            acc.outRms[ch] = std::sqrt(acc.outRms[ch] * acc.outRms[ch] * (1.0f - w) + b.outRms[ch] * b.outRms[ch] * w);
+        }
+        acc.grMin = std::min(acc.grMin, b.grMin);
+        acc.grMax = std::max(acc.grMax, b.grMax);
+        acc.flux = std::max(acc.flux, b.flux);
+        acc.crest = b.crest;
+    }
+
+    static void flatten(const MeterFrame& f, float* v) noexcept
+    {
+        v[0] = f.inPeak[0];  v[1] = f.inPeak[1];  v[2] = f.inRms[0];  v[3] = f.inRms[1];
+        v[4] = f.outPeak[0]; v[5] = f.outPeak[1]; v[6] = f.outRms[0]; v[7] = f.outRms[1];
+        v[8] = f.grMin; v[9] = f.grMax; v[10] = f.flux; v[11] = f.crest;
+    }
+
+    static void unflatten(const float* v, MeterFrame& f) noexcept
+    {
+        f.inPeak[0] = v[0];  f.inPeak[1] = v[1];  f.inRms[0] = v[2];  f.inRms[1] = v[3];
+        f.outPeak[0] = v[4]; f.outPeak[1] = v[5]; f.outRms[0] = v[6]; f.outRms[1] = v[7];
+        f.grMin = v[8]; f.grMax = v[9]; f.flux = v[10]; f.crest = v[11];
+    }
+
+    // Written by the audio thread, read by the UI.
+    struct alignas(64) WriterLine
+    {
+        std::atomic<std::uint32_t> sequence{ 0 };
+        std::atomic<float> values[MeterFrame::numValues]{};
+    } writer;
+
+    // Written by the UI, read by the audio thread.
+    struct alignas(64) ReaderLine
+    {
+        std::atomic<std::uint32_t> ackSequence{ 0 };
+    } reader;
+
+    // Audio thread only.
+    MeterFrame pending;
+    int pendingBlocks = 0;
+
+    static_assert(sizeof(WriterLine) <= 64, "telemetry must fit one cache line");
+};
@@ -0,0 +1,503 @@
+/*
+  ==============================================================================
+    MixBusSimd.h
+    Small SIMD kernels for the block-level stages of UltimateCompDSP.
+    - SSE2 / NEON with a scalar fallback (same per-sample arithmetic in every path,
+      so the output does not depend on the instruction set)
+    - Unaligned loads/stores: host buffers and chunk offsets carry no alignment guarantee
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include "FastMath.h"
+#include "SimpleBiquad.h"
+
+#if JUCE_USE_SSE_INTRINSICS
+ #include <emmintrin.h>
+#elif JUCE_USE_ARM_NEON
+ #include <arm_neon.h>
+#endif
+
+// Double-precision NEON only exists on AArch64; 32-bit ARM takes the scalar Double2.
+#if JUCE_USE_ARM_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+ #define MIXBUS_NEON_F64 1
+#else
+ #define MIXBUS_NEON_F64 0
+#endif
+
+namespace MixBusSimd
+{
+    // Running peak / sum of squares for one channel, accumulated across chunks.
+    struct LevelAccumulator
+    {
+        float peak = 0.0f;
+        double sumSquares = 0.0;
+        int numSamples = 0;
+
+        void clear() noexcept { peak = 0.0f; sumSquares = 0.0; numSamples = 0; }
+
+        void addSample(float x) noexcept
+        {
+            peak = std::max(peak, std::abs(x));
+            sumSquares += (double)x * (double)x;
+            ++numSamples;
+        }
+
+        float rms() const noexcept { return numSamples > 0 ? (float)std::sqrt(sumSquares / (double)numSamples) : 0.0f; }
+    };
+
+    // ==============================================================================
+    // INPUT STAGE
+    // a = in * meterGain   -> metered (peak + sum of squares)
+    // y = a * workGain     -> written to dst0, dst1 and (optionally) dst2
+    // The overload without a LevelAccumulator skips the metering.
+    // ==============================================================================
+    template <bool Metered>
+    inline void gainCopyKernel(const float* in, float meterGain, float workGain,
+                               float* dst0, float* dst1, float* dst2,
+                               int n, LevelAccumulator* level) noexcept
+    {
+        int i = 0;
+        float peak = Metered ? level->peak : 0.0f;
+        double sum = 0.0;
+
+#if JUCE_USE_SSE_INTRINSICS
+        {
+            const __m128 gm = _mm_set1_ps(meterGain);
+            const __m128 gw = _mm_set1_ps(workGain);
+            const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+            __m128 vpeak = _mm_set1_ps(peak);
+            __m128 vsum = _mm_setzero_ps();
+
+            for (; i + 4 <= n; i += 4)
+            {
+                const __m128 a = _mm_mul_ps(_mm_loadu_ps(in + i), gm);
+                if constexpr (Metered)
+                {
+                    vpeak = _mm_max_ps(vpeak, _mm_and_ps(a, absMask));
+                    vsum = _mm_add_ps(vsum, _mm_mul_ps(a, a));
+                }
+
+                const __m128 y = _mm_mul_ps(a, gw);
+                _mm_storeu_ps(dst0 + i, y);
+                _mm_storeu_ps(dst1 + i, y);
+                if (dst2 != nullptr) _mm_storeu_ps(dst2 + i, y);
+            }
+
+            alignas(16) float p[4], s[4];
+            _mm_store_ps(p, vpeak);
+            _mm_store_ps(s, vsum);
+            peak = std::max(std::max(p[0], p[1]), std::max(p[2], p[3]));
+            sum = (double)s[0] + (double)s[1] + (double)s[2] + (double)s[3];
+        }
+#elif JUCE_USE_ARM_NEON
+        {
+            const float32x4_t gm = vdupq_n_f32(meterGain);
+            const float32x4_t gw = vdupq_n_f32(workGain);
+            float32x4_t vpeak = vdupq_n_f32(peak);
+            float32x4_t vsum = vdupq_n_f32(0.0f);
+
+            for (; i + 4 <= n; i += 4)
+            {
+                const float32x4_t a = vmulq_f32(vld1q_f32(in + i), gm);
+                if constexpr (Metered)
+                {
+                    vpeak = vmaxq_f32(vpeak, vabsq_f32(a));
+                    vsum = vmlaq_f32(vsum, a, a);
+                }
+
+                const float32x4_t y = vmulq_f32(a, gw);
+                vst1q_f32(dst0 + i, y);
+                vst1q_f32(dst1 + i, y);
+                if (dst2 != nullptr) vst1q_f32(dst2 + i, y);
+            }
+
+            float p[4], s[4];
+            vst1q_f32(p, vpeak);
+            vst1q_f32(s, vsum);
+            peak = std::max(std::max(p[0], p[1]), std::max(p[2], p[3]));
+            sum = (double)s[0] + (double)s[1] + (double)s[2] + (double)s[3];
+        }
+#endif
+
+        for (; i < n; ++i)
+        {
+            const float a = in[i] * meterGain;
+            if constexpr (Metered)
+            {
+                peak = std::max(peak, std::abs(a));
+                sum += (double)a * (double)a;
+            }
+
+            const float y = a * workGain;
+            dst0[i] = y;
+            dst1[i] = y;
+            if (dst2 != nullptr) dst2[i] = y;
+        }
+
+        if constexpr (Metered)
+        {
+            level->peak = peak;
+            level->sumSquares += sum;
+            level->numSamples += n;
+        }
+    }
+
+    inline void gainMeterCopy(const float* in, float meterGain, float workGain,
+                              float* dst0, float* dst1, float* dst2,
+                              int n, LevelAccumulator& level) noexcept
+    {
+        gainCopyKernel<true>(in, meterGain, workGain, dst0, dst1, dst2, n, &level);
+    }
+
+    inline void gainMeterCopy(const float* in, float meterGain, float workGain,
+                              float* dst0, float* dst1, float* dst2, int n) noexcept
+    {
+        gainCopyKernel<false>(in, meterGain, workGain, dst0, dst1, dst2, n, nullptr);
+    }
+
+    // ==============================================================================
+    // OUTPUT STAGE
+    // y = (wet * wetGain + dry * dryGain [+ mojo * mojoGain]) * outGain -> out, metered
+    // All gains are per-block scalars; the caller runs any per-sample ramp as a prologue.
+    // The overload without a LevelAccumulator skips the metering.
+    // ==============================================================================
+    template <bool Metered>
+    inline void mixKernel(const float* wet, const float* dry, const float* mojo,
+                          float wetGain, float dryGain, float mojoGain, float outGain,
+                          float* out, int n, LevelAccumulator* level) noexcept
+    {
+        int i = 0;
+        float peak = Metered ? level->peak : 0.0f;
+        double sum = 0.0;
+
+#if JUCE_USE_SSE_INTRINSICS
+        {
+            const __m128 gw = _mm_set1_ps(wetGain);
+            const __m128 gd = _mm_set1_ps(dryGain);
+            const __m128 gm = _mm_set1_ps(mojoGain);
+            const __m128 go = _mm_set1_ps(outGain);
+            const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+            __m128 vpeak = _mm_set1_ps(peak);
+            __m128 vsum = _mm_setzero_ps();
+
+            for (; i + 4 <= n; i += 4)
+            {
+                __m128 x = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(wet + i), gw), _mm_mul_ps(_mm_loadu_ps(dry + i), gd));
+                if (mojo != nullptr) x = _mm_add_ps(x, _mm_mul_ps(_mm_loadu_ps(mojo + i), gm));
+
+                const __m128 y = _mm_mul_ps(x, go);
+                _mm_storeu_ps(out + i, y);
+                if constexpr (Metered)
+                {
+                    vpeak = _mm_max_ps(vpeak, _mm_and_ps(y, absMask));
+                    vsum = _mm_add_ps(vsum, _mm_mul_ps(y, y));
+                }
+            }
+
+            alignas(16) float p[4], s[4];
+            _mm_store_ps(p, vpeak);
+            _mm_store_ps(s, vsum);
+            peak = std::max(std::max(p[0], p[1]), std::max(p[2], p[3]));
+            sum = (double)s[0] + (double)s[1] + (double)s[2] + (double)s[3];
+        }
+#elif JUCE_USE_ARM_NEON
+        {
+            const float32x4_t gw = vdupq_n_f32(wetGain);
+            const float32x4_t gd = vdupq_n_f32(dryGain);
+            const float32x4_t gm = vdupq_n_f32(mojoGain);
+            const float32x4_t go = vdupq_n_f32(outGain);
+            float32x4_t vpeak = vdupq_n_f32(peak);
+            float32x4_t vsum = vdupq_n_f32(0.0f);
+
+            for (; i + 4 <= n; i += 4)
+            {
+                float32x4_t x = vaddq_f32(vmulq_f32(vld1q_f32(wet + i), gw), vmulq_f32(vld1q_f32(dry + i), gd));
+                if (mojo != nullptr) x = vaddq_f32(x, vmulq_f32(vld1q_f32(mojo + i), gm));
+
+                const float32x4_t y = vmulq_f32(x, go);
+                vst1q_f32(out + i, y);
+                if constexpr (Metered)
+                {
+                    vpeak = vmaxq_f32(vpeak, vabsq_f32(y));
+                    vsum = vmlaq_f32(vsum, y, y);
+                }
+            }
+
+            float p[4], s[4];
+            vst1q_f32(p, vpeak);
+            vst1q_f32(s, vsum);
+            peak = std::max(std::max(p[0], p[1]), std::max(p[2], p[3]));
+            sum = (double)s[0] + (double)s[1] + (double)s[2] + (double)s[3];
+        }
+#endif
+
+        for (; i < n; ++i)
+        {
+            float x = wet[i] * wetGain + dry[i] * dryGain;
+            if (mojo != nullptr) x += mojo[i] * mojoGain;
+
+            const float y = x * outGain;
+            out[i] = y;
+            if constexpr (Metered)
+            {
+                peak = std::max(peak, std::abs(y));
+                sum += (double)y * (double)y;
+            }
+        }
+
+        if constexpr (Metered)
+        {
+            level->peak = peak;
+            level->sumSquares += sum;
+            level->numSamples += n;
+        }
+    }
+
+    inline void mixMeter(const float* wet, const float* dry, const float* mojo,
+                         float wetGain, float dryGain, float mojoGain, float outGain,
+                         float* out, int n, LevelAccumulator& level) noexcept
+    {
+        mixKernel<true>(wet, dry, mojo, wetGain, dryGain, mojoGain, outGain, out, n, &level);
+    }
+
+    inline void mixMeter(const float* wet, const float* dry, const float* mojo,
+                         float wetGain, float dryGain, float mojoGain, float outGain,
+                         float* out, int n) noexcept
+    {
+        mixKernel<false>(wet, dry, mojo, wetGain, dryGain, mojoGain, outGain, out, n, nullptr);
+    }
+
+    // ==============================================================================
+    // DOUBLE2
+    // Two double lanes (left / right) for the stereo detector. Comparisons return lane masks
+    // for select(); arithmetic is the same IEEE operation per lane as the scalar code.
+    // ==============================================================================
+    struct Double2
+    {
+#if JUCE_USE_SSE_INTRINSICS
+        __m128d v;
+
+        static Double2 set(double a, double b) noexcept        { return { _mm_set_pd(b, a) }; }
+        static Double2 broadcast(double a) noexcept            { return { _mm_set1_pd(a) }; }
+        static Double2 load(const double* p) noexcept          { return { _mm_loadu_pd(p) }; }
+        void store(double* p) const noexcept                   { _mm_storeu_pd(p, v); }
+        static Double2 loadFloat(const float* p) noexcept      { return { _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)))) }; }
+        void storeFloat(float* p) const noexcept               { _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(_mm_cvtpd_ps(v))); }
+        double lane0() const noexcept                          { return _mm_cvtsd_f64(v); }
+        double lane1() const noexcept                          { return _mm_cvtsd_f64(_mm_unpackhi_pd(v, v)); }
+
+        friend Double2 operator+ (Double2 a, Double2 b) noexcept { return { _mm_add_pd(a.v, b.v) }; }
+        friend Double2 operator- (Double2 a, Double2 b) noexcept { return { _mm_sub_pd(a.v, b.v) }; }
+        friend Double2 operator* (Double2 a, Double2 b) noexcept { return { _mm_mul_pd(a.v, b.v) }; }
+        friend Double2 operator/ (Double2 a, Double2 b) noexcept { return { _mm_div_pd(a.v, b.v) }; }
+
+        static Double2 min(Double2 a, Double2 b) noexcept      { return { _mm_min_pd(a.v, b.v) }; }
+        static Double2 max(Double2 a, Double2 b) noexcept      { return { _mm_max_pd(a.v, b.v) }; }
+        static Double2 sqrt(Double2 a) noexcept                { return { _mm_sqrt_pd(a.v) }; }
+        static Double2 abs(Double2 a) noexcept                 { return { _mm_andnot_pd(_mm_set1_pd(-0.0), a.v) }; }
+        static Double2 roundToFloat(Double2 a) noexcept        { return { _mm_cvtps_pd(_mm_cvtpd_ps(a.v)) }; }
+        static Double2 lessThan(Double2 a, Double2 b) noexcept { return { _mm_cmplt_pd(a.v, b.v) }; }
+        static Double2 select(Double2 mask, Double2 a, Double2 b) noexcept
+        {
+            return { _mm_or_pd(_mm_and_pd(mask.v, a.v), _mm_andnot_pd(mask.v, b.v)) };
+        }
+        static bool all(Double2 mask) noexcept                 { return _mm_movemask_pd(mask.v) == 3; }
+
+        // 2^n for lanes that hold exp2Shifter + n (see MixBusMath::exp2)
+        static Double2 pow2FromShifted(Double2 shifted) noexcept
+        {
+            const __m128i n = _mm_sub_epi64(_mm_castpd_si128(shifted.v), _mm_castpd_si128(_mm_set1_pd(MixBusMath::Detail::exp2Shifter)));
+            return { _mm_castsi128_pd(_mm_slli_epi64(_mm_add_epi64(n, _mm_set1_epi64x(1023)), 52)) };
+        }
+#elif MIXBUS_NEON_F64
+        float64x2_t v;
+
+        static Double2 set(double a, double b) noexcept        { return { vsetq_lane_f64(b, vdupq_n_f64(a), 1) }; }
+        static Double2 broadcast(double a) noexcept            { return { vdupq_n_f64(a) }; }
+        static Double2 load(const double* p) noexcept          { return { vld1q_f64(p) }; }
+        void store(double* p) const noexcept                   { vst1q_f64(p, v); }
+        static Double2 loadFloat(const float* p) noexcept      { return { vcvt_f64_f32(vld1_f32(p)) }; }
+        void storeFloat(float* p) const noexcept               { vst1_f32(p, vcvt_f32_f64(v)); }
+        double lane0() const noexcept                          { return vgetq_lane_f64(v, 0); }
+        double lane1() const noexcept                          { return vgetq_lane_f64(v, 1); }
+
+        friend Double2 operator+ (Double2 a, Double2 b) noexcept { return { vaddq_f64(a.v, b.v) }; }
+        friend Double2 operator- (Double2 a, Double2 b) noexcept { return { vsubq_f64(a.v, b.v) }; }
+        friend Double2 operator* (Double2 a, Double2 b) noexcept { return { vmulq_f64(a.v, b.v) }; }
+        friend Double2 operator/ (Double2 a, Double2 b) noexcept { return { vdivq_f64(a.v, b.v) }; }
+
+        static Double2 min(Double2 a, Double2 b) noexcept      { return { vminq_f64(a.v, b.v) }; }
+        static Double2 max(Double2 a, Double2 b) noexcept      { return { vmaxq_f64(a.v, b.v) }; }
+        static Double2 sqrt(Double2 a) noexcept                { return { vsqrtq_f64(a.v) }; }
+        static Double2 abs(Double2 a) noexcept                 { return { vabsq_f64(a.v) }; }
+        static Double2 roundToFloat(Double2 a) noexcept        { return { vcvt_f64_f32(vcvt_f32_f64(a.v)) }; }
+        static Double2 lessThan(Double2 a, Double2 b) noexcept { return { vreinterpretq_f64_u64(vcltq_f64(a.v, b.v)) }; }
+        static Double2 select(Double2 mask, Double2 a, Double2 b) noexcept
+        {
+            return { vbslq_f64(vreinterpretq_u64_f64(mask.v), a.v, b.v) };
+        }
+        static bool all(Double2 mask) noexcept
+        {
+            const uint64x2_t m = vreinterpretq_u64_f64(mask.v);
+            return (vgetq_lane_u64(m, 0) & vgetq_lane_u64(m, 1)) != 0;
+        }
+
+        static Double2 pow2FromShifted(Double2 shifted) noexcept
+        {
+            const uint64x2_t n = vsubq_u64(vreinterpretq_u64_f64(shifted.v), vreinterpretq_u64_f64(vdupq_n_f64(MixBusMath::Detail::exp2Shifter)));
+            return { vreinterpretq_f64_u64(vshlq_n_u64(vaddq_u64(n, vdupq_n_u64(1023)), 52)) };
+        }
+#else
+        double v[2];
+
+        static Double2 set(double a, double b) noexcept        { return { { a, b } }; }
+        static Double2 broadcast(double a) noexcept            { return { { a, a } }; }
+        static Double2 load(const double* p) noexcept          { return { { p[0], p[1] } }; }
+        void store(double* p) const noexcept                   { p[0] = v[0]; p[1] = v[1]; }
+        static Double2 loadFloat(const float* p) noexcept      { return { { (double)p[0], (double)p[1] } }; }
+        void storeFloat(float* p) const noexcept               { p[0] = (float)v[0]; p[1] = (float)v[1]; }
+        double lane0() const noexcept                          { return v[0]; }
+        double lane1() const noexcept                          { return v[1]; }
+
+        friend Double2 operator+ (Double2 a, Double2 b) noexcept { return { { a.v[0] + b.v[0], a.v[1] + b.v[1] } }; }
+        friend Double2 operator- (Double2 a, Double2 b) noexcept { return { { a.v[0] - b.v[0], a.v[1] - b.v[1] } }; }
+        friend Double2 operator* (Double2 a, Double2 b) noexcept { return { { a.v[0] * b.v[0], a.v[1] * b.v[1] } }; }
+        friend Double2 operator/ (Double2 a, Double2 b) noexcept { return { { a.v[0] / b.v[0], a.v[1] / b.v[1] } }; }
+
+        static Double2 min(Double2 a, Double2 b) noexcept      { return { { a.v[0] < b.v[0] ? a.v[0] : b.v[0], a.v[1] < b.v[1] ? a.v[1] : b.v[1] } }; }
+        static Double2 max(Double2 a, Double2 b) noexcept      { return { { a.v[0] > b.v[0] ? a.v[0] : b.v[0], a.v[1] > b.v[1] ? a.v[1] : b.v[1] } }; }
+        static Double2 sqrt(Double2 a) noexcept                { return { { std::sqrt(a.v[0]), std::sqrt(a.v[1]) } }; }
+        static Double2 abs(Double2 a) noexcept                 { return { { std::abs(a.v[0]), std::abs(a.v[1]) } }; }
+        static Double2 roundToFloat(Double2 a) noexcept        { return { { (double)(float)a.v[0], (double)(float)a.v[1] } }; }
+        static Double2 lessThan(Double2 a, Double2 b) noexcept { return { { a.v[0] < b.v[0] ? 1.0 : 0.0, a.v[1] < b.v[1] ? 1.0 : 0.0 } }; }
+        static Double2 select(Double2 mask, Double2 a, Double2 b) noexcept
+        {
+            return { { mask.v[0] != 0.0 ? a.v[0] : b.v[0], mask.v[1] != 0.0 ? a.v[1] : b.v[1] } };
+        }
+        static bool all(Double2 mask) noexcept                 { return mask.v[0] != 0.0 && mask.v[1] != 0.0; }
+
+        static Double2 pow2FromShifted(Double2 shifted) noexcept
+        {
+            using namespace MixBusMath::Detail;
+            const std::uint64_t k = bitsOf(exp2Shifter);
+            return { { fromBits((bitsOf(shifted.v[0]) - k + 1023u) << 52), fromBits((bitsOf(shifted.v[1]) - k + 1023u) << 52) } };
+        }
+#endif
+
+        friend Double2 operator+ (double a, Double2 b) noexcept { return broadcast(a) + b; }
+        friend Double2 operator+ (Double2 a, double b) noexcept { return a + broadcast(b); }
+        friend Double2 operator- (Double2 a, double b) noexcept { return a - broadcast(b); }
+        friend Double2 operator* (double a, Double2 b) noexcept { return broadcast(a) * b; }
+        friend Double2 operator* (Double2 a, double b) noexcept { return a * broadcast(b); }
+        friend Double2 operator/ (Double2 a, double b) noexcept { return a / broadcast(b); }
+    };
+
+    // 2-lane MixBusMath::exp2, same polynomial and result per lane as the scalar version.
+    template <MixBusMath::Accuracy A>
+    inline Double2 exp2(Double2 x) noexcept
+    {
+        using namespace MixBusMath::Detail;
+
+        if constexpr (A == MixBusMath::Accuracy::Exact)
+        {
+            return Double2::set(std::exp2(x.lane0()), std::exp2(x.lane1()));
+        }
+        else
+        {
+            const Double2 shifted = x + exp2Shifter;
+            const Double2 n = shifted - exp2Shifter;
+            return expSeries<A>((x - n) * ln2) * Double2::pow2FromShifted(shifted);
+        }
+    }
+
+    // 2-lane MixBusMath::dbToLin, same polynomial and result per lane as the scalar version.
+    template <MixBusMath::Accuracy A>
+    inline Double2 dbToLin(Double2 db) noexcept
+    {
+        if constexpr (A == MixBusMath::Accuracy::Exact)
+            return Double2::set(MixBusMath::dbToLin<A>(db.lane0()), MixBusMath::dbToLin<A>(db.lane1()));
+        else
+            return exp2<A>(db * 0.16609640474436811); // log2(10) / 20
+    }
+
+    // ==============================================================================
+    // STEREO BIQUAD CASCADE
+    // Runs the first N stages of left[] / right[] in series over a block, in place, each
+    // stage's L/R filters sharing one Double2.
+    // Every stage advances once per sample, so their feedback paths overlap instead of each
+    // stage sweeping the block alone. Per lane this is SimpleBiquad::process exactly (same
+    // evaluation order, non-finite reset and denormal flush), and the filters' state is
+    // written back at the end.
+    // ==============================================================================
+    template <int N>
+    inline void biquadCascade(SimpleBiquad* const* left, SimpleBiquad* const* right,
+                              double* xl, double* xr, int n) noexcept
+    {
+        struct Stage { Double2 b0, b1, b2, a1, a2, x1, x2, y1, y2; };
+        Stage st[N];
+
+        for (int k = 0; k < N; ++k)
+        {
+            const SimpleBiquad& l = *left[k];
+            const SimpleBiquad& r = *right[k];
+            st[k] = { Double2::set(l.b0, r.b0), Double2::set(l.b1, r.b1), Double2::set(l.b2, r.b2),
+                      Double2::set(l.a1, r.a1), Double2::set(l.a2, r.a2),
+                      Double2::set(l.x1, r.x1), Double2::set(l.x2, r.x2),
+                      Double2::set(l.y1, r.y1), Double2::set(l.y2, r.y2) };
+        }
+
+        const Double2 zero = Double2::broadcast(0.0);
+        const Double2 inf = Double2::broadcast(std::numeric_limits<double>::infinity());
+        const Double2 tiny = Double2::broadcast(1e-24);
+
+        for (int i = 0; i < n; ++i)
+        {
+            Double2 x = Double2::set(xl[i], xr[i]);
+
+            for (int k = 0; k < N; ++k)
+            {
+                Stage& s = st[k];
+                Double2 y = s.b0 * x + s.b1 * s.x1 + s.b2 * s.x2 - s.a1 * s.y1 - s.a2 * s.y2;
+                Double2 ay = Double2::abs(y);
+
+                const Double2 finite = Double2::lessThan(ay, inf);
+                if (!Double2::all(finite))
+                {
+                    // A lane went unstable: zero its output and clear its state, as process() does.
+                    y = Double2::select(finite, y, zero);
+                    ay = Double2::abs(y);
+                    s.x1 = Double2::select(finite, s.x1, zero);
+                    s.y1 = Double2::select(finite, s.y1, zero);
+                }
+
+                y = Double2::select(Double2::lessThan(ay, tiny), zero, y);
+
+                s.x2 = s.x1;
+                s.x1 = x;
+                s.y2 = s.y1;
+                s.y1 = y;
+                x = y;
+            }
+
+            xl[i] = x.lane0();
+            xr[i] = x.lane1();
+        }
+
+        for (int k = 0; k < N; ++k)
+        {
+            SimpleBiquad& l = *left[k];
+            SimpleBiquad& r = *right[k];
+            l.x1 = st[k].x1.lane0(); r.x1 = st[k].x1.lane1();
+            l.x2 = st[k].x2.lane0(); r.x2 = st[k].x2.lane1();
+            l.y1 = st[k].y1.lane0(); r.y1 = st[k].y1.lane1();
+            l.y2 = st[k].y2.lane0(); r.y2 = st[k].y2.lane1();
+        }
+    }
+}
@@ -0,0 +1,163 @@
+/*
+  ==============================================================================
+    OversamplingStage.h
+    Off-audio-thread construction of the Saturation oversampler.
+    - OversamplingPath: one Quality mode's oversampler, its latency and its
+      measured round-trip impulse response
+    - OversamplingStage: the audio thread asks for a mode, a worker builds it and
+      hands it over; only the mode in use (plus, briefly, the one it replaced)
+      is ever allocated
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// ==============================================================================
+// OVERSAMPLING PATH
+// ==============================================================================
+struct OversamplingPath
+{
+    // Quality modes: Live, Mix, Master.
+    // - Live: 2x, polyphase IIR at its short setting (a few samples, minimum-phase-like)
+    // - Mix: 4x polyphase IIR at max quality (the original voicing)
+    // - Master: 8x equiripple FIR, linear phase, the longest latency
+    static constexpr int numModes = 3;
+
+    static constexpr int modeStages[numModes] = { 1, 2, 3 };
+    static constexpr bool modeMaxQuality[numModes] = { false, true, true };
+    static constexpr juce::dsp::Oversampling<float>::FilterType modeFilters[numModes] = {
+        juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR,
+        juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR,
+        juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple
+    };
+
+    std::unique_ptr<juce::dsp::Oversampling<float>> os;
+    int mode = 1;
+    int stages = 2;
+    int latency = 0;
+    std::vector<float> response; // measured up / down impulse response
+
+    // Allocates: prepare() or the worker only. responseLength is the number of taps measured.
+    static std::unique_ptr<OversamplingPath> build(int mode, int numChannels, int maxBlock, int responseLength)
+    {
+        auto path = std::make_unique<OversamplingPath>();
+        path->mode = juce::jlimit(0, numModes - 1, mode);
+        path->stages = modeStages[path->mode];
+        path->os = std::make_unique<juce::dsp::Oversampling<float>>(
+            (size_t)std::max(1, numChannels), (size_t)path->stages, modeFilters[path->mode], modeMaxQuality[path->mode]);
+        path->os->initProcessing((size_t)maxBlock);
+
+        // Cache oversampling latency for host reporting
+        path->latency = (int)path->os->getLatencyInSamples();
+
+        path->response.assign((size_t)std::max(1, responseLength), 0.0f);
+        measureResponse(*path->os, maxBlock, path->response);
+        return path;
+    }
+
+    // Runs a unit impulse through the up / down round trip (no nonlinearity), then resets it.
+    static void measureResponse(juce::dsp::Oversampling<float>& oversampler, int maxBlock, std::vector<float>& response)
+    {
+        juce::AudioBuffer<float> probe(1, maxBlock);
+        const int length = (int)response.size();
+
+        for (int done = 0; done < length; done += maxBlock)
+        {
+            const int n = std::min(maxBlock, length - done);
+            probe.clear();
+            if (done == 0) probe.setSample(0, 0, 1.0f);
+
+            auto block = juce::dsp::AudioBlock<float>(probe).getSubBlock(0, (size_t)n);
+            oversampler.processSamplesUp(block);
+            oversampler.processSamplesDown(block);
+            std::copy(probe.getReadPointer(0), probe.getReadPointer(0) + n, response.begin() + done);
+        }
+
+        oversampler.reset();
+    }
+};
+
+// ==============================================================================
+// OVERSAMPLING STAGE
+// One hand-over slot. While it is Empty the worker owns it: it builds the requested
+// mode there, or frees what the audio thread left behind. Once Ready the audio thread
+// owns it and swaps the new path for the one it was running (see exchange()).
+// ==============================================================================
+class OversamplingStage : public juce::TimeSliceClient
+{
+public:
+    // --- prepare() (never while the audio thread processes) ---
+    void configure(int numChannels, int maxBlock, int responseLength)
+    {
+        const juce::ScopedLock sl(buildLock);
+        channels = numChannels;
+        block = maxBlock;
+        taps = responseLength;
+        wanted.store(-1, std::memory_order_relaxed);
+        ready.store(false, std::memory_order_relaxed);
+        slot.reset();
+    }
+
+    // --- AUDIO THREAD ---
+    // Mode the engine wants next, or -1 when it already runs the one it wants.
+    void request(int mode) noexcept { wanted.store(mode, std::memory_order_relaxed); }
+
+    // Swaps current for a finished path of this mode; false while none is ready. A finished
+    // path of another mode (the request moved on meanwhile) goes back to the worker.
+    bool exchange(int mode, std::unique_ptr<OversamplingPath>& current) noexcept
+    {
+        if (!ready.load(std::memory_order_acquire))
+            return false;
+
+        const bool match = (slot != nullptr && slot->mode == mode);
+        if (match)
+        {
+            std::swap(current, slot); // the old path is freed on the worker
+            wanted.store(-1, std::memory_order_relaxed);
+        }
+
+        ready.store(false, std::memory_order_release);
+        return match;
+    }
+
+    // --- WORKER ---
+    int useTimeSlice() override
+    {
+        const juce::ScopedLock sl(buildLock);
+
+        if (ready.load(std::memory_order_acquire))
+            return idlePollMs;
+
+        const int mode = wanted.load(std::memory_order_relaxed);
+        if (mode < 0)
+        {
+            slot.reset(); // nothing to hand over: drop the path the last switch retired
+            return idlePollMs;
+        }
+
+        // The retired path may be the very mode asked for again (switching back)
+        if (slot == nullptr || slot->mode != mode)
+        {
+            slot.reset();
+            slot = OversamplingPath::build(mode, channels, block, taps);
+        }
+
+        ready.store(true, std::memory_order_release);
+        return idlePollMs;
+    }
+
+private:
+    static constexpr int idlePollMs = 20;
+
+    juce::CriticalSection buildLock; // configure() against the worker (never taken on the audio thread)
+    std::unique_ptr<OversamplingPath> slot;
+    std::atomic<bool> ready{ false };
+    std::atomic<int> wanted{ -1 };
+    int channels = 2, block = 512, taps = 1;
+};
@@ -0,0 +1,240 @@
+/*
+  ==============================================================================
+    ParameterTable.h
+    Single compile-time description of every host parameter.
+    - Drives the APVTS layout, the cached pointer binding and the DSP snapshot
+    - Order is the host-facing parameter order: append new entries at the end
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace MixBusParams
+{
+    // Index of each parameter in the table (and in Snapshot::values).
+    // Names match the parameter IDs, so a typo fails to compile instead of silently reading a default.
+    enum Index : int
+    {
+        sc_mode, ms_mode, ms_balance, sc_to_comp, active_dyn, active_det, active_crest, active_tf,
+        active_sat, active_eq, thresh, ratio, knee, att_ms, turbo_att, rel_ms,
+        turbo_rel, auto_rel, signal_flow, comp_input, comp_mirror, makeup, comp_autogain, dry_wet,
+        in_gain, out_trim, ctrl_mode, crest_target, crest_speed, thrust_mode, det_rms, stereo_link,
+        sc_hp_freq, sc_lp_freq, fb_blend, sc_level_db, sc_audition, sc_td_amt, sc_td_ms, tp_mode,
+        tp_amount, tp_thresh_raise, flux_mode, flux_amount, sat_mode, sat_pre_gain, sat_mirror, sat_drive,
+        sat_trim, sat_tone, sat_tone_freq, sat_mix, sat_autogain, harm_bright, harm_freq, show_help,
+        stuff, stuff_bal, girth, girth_freq, dbg_bq, dbg_dq, dbg_rat, det_rate, cl_rate,
+        lookahead, quality_mode, render_quality,
+        NumParams
+    };
+
+    enum class Kind : std::uint8_t { Float, Bool, Choice };
+
+    struct Descriptor
+    {
+        Index index;
+        const char* id;
+        const char* name;
+        Kind kind;
+        float minValue, maxValue, defaultValue;
+        float interval;      // Float only: 0 = continuous (default 0.01, as AudioParameterFloat(id, name, min, max, def))
+        float displayOffset; // Float only: added to the raw value for display / text entry
+        const char* choices; // Choice only: '|' separated item names
+    };
+
+    constexpr Descriptor floatParam(Index index, const char* id, const char* name, float minValue, float maxValue, float defaultValue,
+                                    float interval = 0.01f, float displayOffset = 0.0f)
+    {
+        return { index, id, name, Kind::Float, minValue, maxValue, defaultValue, interval, displayOffset, "" };
+    }
+
+    constexpr Descriptor boolParam(Index index, const char* id, const char* name, bool defaultValue)
+    {
+        return { index, id, name, Kind::Bool, 0.0f, 1.0f, defaultValue ? 1.0f : 0.0f, 1.0f, 0.0f, "" };
+    }
+
+    constexpr int countChoices(const char* choices)
+    {
+        int n = 1;
+        for (; *choices != 0; ++choices)
+            if (*choices == '|') ++n;
+        return n;
+    }
+
+    constexpr Descriptor choiceParam(Index index, const char* id, const char* name, const char* choices, int defaultIndex)
+    {
+        return { index, id, name, Kind::Choice, 0.0f, (float)(countChoices(choices) - 1), (float)defaultIndex, 1.0f, 0.0f, choices };
+    }
+
+    inline constexpr Descriptor table[NumParams] =
+    {
+        // --- SIDECHAIN PARAMS ---
+        choiceParam(sc_mode, "sc_mode", "SC Input", "In|Ext", 0),
+        choiceParam(ms_mode, "ms_mode", "M/S Mode", "Link|Mid|Side|M>S|S>M", 0),
+        floatParam(ms_balance, "ms_balance", "M/S Balance", -12.0f, 12.0f, 0.0f),
+
+        // Routing Toggles
+        boolParam(sc_to_comp, "sc_to_comp", "SC -> Comp", true),
+
+        // MAIN PARAMS
+        boolParam(active_dyn, "active_dyn", "Dynamics On", true),
+        boolParam(active_det, "active_det", "Detector On", true),
+        boolParam(active_crest, "active_crest", "Crest On", true),
+        boolParam(active_tf, "active_tf", "Transient/Flux On", true),
+        boolParam(active_sat, "active_sat", "Saturation On", true),
+        boolParam(active_eq, "active_eq", "Color EQ On", true),
+
+        // UI/automation display offset: raw -20.0 dB should read 0.0 dB (DSP unchanged).
+        floatParam(thresh, "thresh", "Threshold", -60.0f, 0.0f, -20.0f, 0.0f, 20.0f),
+        floatParam(ratio, "ratio", "Ratio", 1.0f, 20.0f, 4.0f),
+        floatParam(knee, "knee", "Knee", 0.0f, 24.0f, 6.0f),
+        floatParam(att_ms, "att_ms", "Attack", 0.1f, 200.0f, 10.0f),
+        boolParam(turbo_att, "turbo_att", "Attack 'Faster/Harder'", false),
+        floatParam(rel_ms, "rel_ms", "Release", 10.0f, 2000.0f, 100.0f),
+        boolParam(turbo_rel, "turbo_rel", "Release 'Faster/Harder'", false),
+        choiceParam(auto_rel, "auto_rel", "Auto Release", "Manual|Auto", 0),
+        choiceParam(signal_flow, "signal_flow", "Signal Flow", "Comp > Sat|Sat > Comp", 0),
+
+        // Compressor Input & Mirror
+        floatParam(comp_input, "comp_input", "Input", -24.0f, 24.0f, 0.0f),
+        boolParam(comp_mirror, "comp_mirror", "Mirror", false),
+
+        floatParam(makeup, "makeup", "Comp Output", -24.0f, 24.0f, 0.0f),
+
+        // Compressor Auto-Gain Control
+        choiceParam(comp_autogain, "comp_autogain", "Comp Auto-Gain", "Off|Partial|Full", 0),
+
+        floatParam(dry_wet, "dry_wet", "Dry/Wet %", 0.0f, 100.0f, 100.0f),
+
+        floatParam(in_gain, "in_gain", "Input Gain", -24.0f, 24.0f, 0.0f),
+        floatParam(out_trim, "out_trim", "Output Trim", -24.0f, 24.0f, 0.0f),
+
+        choiceParam(ctrl_mode, "ctrl_mode", "Control Mode", "Manual|Auto Crest", 0),
+        floatParam(crest_target, "crest_target", "Crest Target", 6.0f, 20.0f, 12.0f),
+        floatParam(crest_speed, "crest_speed", "Crest Speed", 50.0f, 4000.0f, 400.0f),
+
+        choiceParam(thrust_mode, "thrust_mode", "Thrust", "Normal|Med (Shelf)|Loud (Pink)", 0),
+        floatParam(det_rms, "det_rms", "RMS Window", 0.0f, 300.0f, 0.0f),
+        floatParam(stereo_link, "stereo_link", "Stereo Link %", 0.0f, 100.0f, 100.0f),
+
+        floatParam(sc_hp_freq, "sc_hp_freq", "SC HPF", 0.0f, 8000.0f, 20.0f),
+        floatParam(sc_lp_freq, "sc_lp_freq", "SC High Cut", 40.0f, 20000.0f, 20000.0f),
+
+        floatParam(fb_blend, "fb_blend", "Feedback Blend %", 0.0f, 100.0f, 0.0f),
+        floatParam(sc_level_db, "sc_level_db", "SC Level (dB)", -24.0f, 24.0f, 0.0f),
+        boolParam(sc_audition, "sc_audition", "SC Audition", false),
+
+        floatParam(sc_td_amt, "sc_td_amt", "SC TD Amount", -100.0f, 100.0f, 0.0f, 0.1f),
+        floatParam(sc_td_ms, "sc_td_ms", "SC TD M/S", 0.0f, 100.0f, 0.0f, 0.1f),
+
+        choiceParam(tp_mode, "tp_mode", "Transient Priority", "Off|On", 0),
+        floatParam(tp_amount, "tp_amount", "TP Amount %", 0.0f, 100.0f, 50.0f),
+        floatParam(tp_thresh_raise, "tp_thresh_raise", "TP Raise (dB)", 0.0f, 24.0f, 12.0f),
+        choiceParam(flux_mode, "flux_mode", "Flux-Coupled", "Off|On", 0),
+        floatParam(flux_amount, "flux_amount", "Flux Amount %", 0.0f, 100.0f, 30.0f),
+
+        choiceParam(sat_mode, "sat_mode", "Transformer", "Clean|Iron|Steel", 0),
+        floatParam(sat_pre_gain, "sat_pre_gain", "Sat Pre Gain", -24.0f, 24.0f, 0.0f),
+        boolParam(sat_mirror, "sat_mirror", "Sat Mirror Input", false),
+        floatParam(sat_drive, "sat_drive", "Sat Drive", 0.0f, 24.0f, 0.0f),
+        floatParam(sat_trim, "sat_trim", "Sat Trim", -24.0f, 0.0f, 0.0f),
+        floatParam(sat_tone, "sat_tone", "Sat Tone", -12.0f, 12.0f, 0.0f),
+        floatParam(sat_tone_freq, "sat_tone_freq", "Sat Tone Freq", 1000.0f, 12000.0f, 5500.0f),
+        floatParam(sat_mix, "sat_mix", "Sat Mix %", 0.0f, 100.0f, 100.0f),
+        choiceParam(sat_autogain, "sat_autogain", "Sat Auto-Gain", "Off|Partial|Full", 1),
+
+        floatParam(harm_bright, "harm_bright", "Harm Bright", -12.0f, 12.0f, 0.0f),
+        floatParam(harm_freq, "harm_freq", "Harm Freq", 1000.0f, 12000.0f, 4500.0f),
+
+        boolParam(show_help, "show_help", "Show Tooltips", false),
+
+        boolParam(stuff, "stuff", "Stuff", false),
+        floatParam(stuff_bal, "stuff_bal", "Stuff Level", -36.0f, 24.0f, 0.0f),
+
+        floatParam(girth, "girth", "Girth", 0.0f, 12.0f, 0.0f),
+        choiceParam(girth_freq, "girth_freq", "Girth Freq", "20|30|60|100", 2),
+        floatParam(dbg_bq, "dbg_bq", "Debug: Boost Q", 0.1f, 3.0f, 0.5f),
+        floatParam(dbg_dq, "dbg_dq", "Debug: Dip Q", 0.1f, 3.0f, 0.5f),
+        floatParam(dbg_rat, "dbg_rat", "Debug: Dip Ratio", 0.1f, 2.0f, 0.35f),
+
+        // Detector / gain computer at ~48 kHz control rate on high-rate sessions
+        choiceParam(det_rate, "det_rate", "Detector Rate", "Full|Control", 0),
+
+        // Update rate of the TP / crest / flux analytics (Detector = every detector step)
+        choiceParam(cl_rate, "cl_rate", "Control Layer Rate", "Detector|4 kHz|2 kHz|1 kHz", 2),
+
+        // Compressor lookahead (ms); adds its length to the reported latency
+        floatParam(lookahead, "lookahead", "Lookahead", 0.0f, 10.0f, 0.0f, 0.1f),
+
+        // Saturation oversampling: 2x low-latency IIR / 4x IIR / 8x linear-phase FIR.
+        // Each reports one fixed latency, whether or not Saturation is on
+        choiceParam(quality_mode, "quality_mode", "Quality", "Live|Mix|Master", 1),
+
+        // Offline bounces: keep the playback settings (default), or opt in to Master oversampling,
+        // a full-rate detector and exact curves (see UltimateCompDSP RENDER PROFILE)
+        choiceParam(render_quality, "render_quality", "Render Quality", "As Playback|Upgrade", 0)
+    };
+
+    // ==============================================================================
+    // Compile-time checks: every slot matches its enum, IDs are unique, defaults are in range.
+    // ==============================================================================
+    constexpr bool idsEqual(const char* a, const char* b)
+    {
+        while (*a != 0 && *a == *b) { ++a; ++b; }
+        return *a == *b;
+    }
+
+    constexpr bool tableIsConsistent()
+    {
+        for (int i = 0; i < NumParams; ++i)
+        {
+            const auto& d = table[i];
+            if (d.index != i) return false;
+            if (!(d.minValue < d.maxValue)) return false;
+            if (d.defaultValue < d.minValue || d.defaultValue > d.maxValue) return false;
+
+            for (int j = 0; j < i; ++j)
+                if (idsEqual(table[j].id, d.id)) return false;
+        }
+        return true;
+    }
+
+    static_assert(tableIsConsistent(), "MixBusParams::table is out of order, has a duplicate ID or a default outside its range");
+
+    // FNV-1a over every ID and kind in table order. Saved states carrying the same hash can be
+    // read positionally; any table edit (add, remove, reorder, retype) changes it.
+    constexpr std::uint32_t schemaHash()
+    {
+        std::uint32_t h = 2166136261u;
+        for (const auto& d : table)
+        {
+            for (const char* c = d.id; *c != 0; ++c)
+                h = (h ^ (std::uint32_t)(unsigned char)*c) * 16777619u;
+            h = (h ^ (std::uint32_t)d.kind) * 16777619u;
+            h = (h ^ 0xffu) * 16777619u; // separator
+        }
+        return h;
+    }
+
+    // ==============================================================================
+    // Packed per-block snapshot: raw APVTS values in table order.
+    // Ingest is a straight copy; the typed readers below are the only place values get decoded.
+    // ==============================================================================
+    struct Snapshot
+    {
+        float values[NumParams];
+
+        constexpr float get(Index i) const noexcept { return values[i]; }
+        constexpr bool  getBool(Index i) const noexcept { return values[i] > 0.5f; }
+        constexpr int   getChoice(Index i) const noexcept { return (int)values[i]; }
+    };
+
+    constexpr Snapshot makeDefaultSnapshot()
+    {
+        Snapshot s {};
+        for (int i = 0; i < NumParams; ++i)
+            s.values[i] = table[i].defaultValue;
+        return s;
+    }
+}
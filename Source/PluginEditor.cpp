@@ -663,23 +663,28 @@ void UltimateCompAudioProcessorEditor::initCombo(juce::ComboBox& box, std::uniqu
 void UltimateCompAudioProcessorEditor::timerCallback()
 {
     const float decay = 0.85f;
-    const float inL = audioProcessor.meterInL.load(std::memory_order_relaxed);
-    const float inR = audioProcessor.meterInR.load(std::memory_order_relaxed);
-    const float outL = audioProcessor.meterOutL.load(std::memory_order_relaxed);
-    const float outR = audioProcessor.meterOutR.load(std::memory_order_relaxed);
+
+    // A frame holds everything since the previous tick; keep the last one if nothing new arrived.
+    audioProcessor.telemetry.read(lastMeterFrame);
+    const auto& m = lastMeterFrame;
+
+    const float inL = m.inPeak[0];
+    const float inR = m.inPeak[1];
+    const float outL = m.outPeak[0];
+    const float outR = m.outPeak[1];
 
     if (inL > smoothInL)  smoothInL = inL;  else smoothInL *= decay;
     if (inR > smoothInR)  smoothInR = inR;  else smoothInR *= decay;
     if (outL > smoothOutL) smoothOutL = outL; else smoothOutL *= decay;
     if (outR > smoothOutR) smoothOutR = outR; else smoothOutR *= decay;
 
-    const float gr = audioProcessor.meterGR.load(std::memory_order_relaxed);
+    const float gr = m.grMin;
     smoothGR = (gr < smoothGR) ? gr : (gr * 0.2f + smoothGR * 0.8f);
 
-    const float fl = audioProcessor.meterFlux.load(std::memory_order_relaxed);
+    const float fl = m.flux;
     if (fl > smoothFlux) smoothFlux = fl; else smoothFlux *= decay;
 
-    const float cr = audioProcessor.meterCrest.load(std::memory_order_relaxed);
+    const float cr = m.crest;
     if (cr > smoothCrest) smoothCrest = cr; else smoothCrest *= decay;
 
     auto updateEnablement = [&](juce::Component& comp, bool shouldEnable) {
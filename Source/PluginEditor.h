@@ -129,6 +129,7 @@ private:
     float smoothInL = 0.f, smoothInR = 0.f;
     float smoothOutL = 0.f, smoothOutR = 0.f;
     float smoothGR = 0.f, smoothFlux = 0.f, smoothCrest = 0.f;
+    MeterFrame lastMeterFrame;
 
     juce::Rectangle<int> inMeterArea, outMeterArea, grBarArea, fluxDotArea, crestDotArea;
 
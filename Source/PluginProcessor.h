@@ -21,6 +21,9 @@
 #pragma warning(pop)
 #endif
 #include "UltimateCompDSP.h"
+#include "ParameterTable.h"
+#include "MeterTelemetry.h"
+#include "StateFormat.h"
 #include "PresetManager.h" // ADDED
 
 class UltimateCompAudioProcessor : public juce::AudioProcessor
@@ -31,6 +34,7 @@ public:
 
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
+    void setNonRealtime(bool isNonRealtime) noexcept override;
 
 #ifndef JucePlugin_PreferredChannelConfigurations
     bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
@@ -63,18 +67,23 @@ public:
     std::unique_ptr<PresetManager> presetManager;
 
     // --- METERING DATA ---
-    std::atomic<float> meterInL{ 0.0f };
-    std::atomic<float> meterInR{ 0.0f };
-    std::atomic<float> meterOutL{ 0.0f };
-    std::atomic<float> meterOutR{ 0.0f };
-    std::atomic<float> meterGR{ 0.0f };
-    std::atomic<float> meterFlux{ 0.0f };
-    std::atomic<float> meterCrest{ 0.0f };
+    // One frame per block (peak/RMS in & out, min/max GR, flux, crest); read with telemetry.read().
+    MeterTelemetry telemetry;
 
 private:
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    void cacheParameterHandles();
+    MixBusParams::Snapshot captureSnapshot() const noexcept;
+    void updateLatency(int samples);
+
+    // Raw parameter values in MixBusParams::table order, resolved from their IDs once at construction.
+    std::array<std::atomic<float>*, MixBusParams::NumParams> paramValues{};
+    std::array<juce::RangedAudioParameter*, MixBusParams::NumParams> paramHandles{};
     UltimateCompDSP dsp;
     int lastLatencySamples = -1;
 
+    // Shared background thread that designs the automatable filter curves for every instance.
+    juce::SharedResourcePointer<FilterDesignThread> filterDesignThread;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UltimateCompAudioProcessor)
 };
\ No newline at end of file
@@ -34,6 +34,50 @@ struct SimpleBiquad {
     double b0 = 0.0, b1 = 0.0, b2 = 0.0;
     double a1 = 0.0, a2 = 0.0;
 
+    // Plain coefficient set, so designs can be made elsewhere and handed over by value.
+    struct Coeffs {
+        double b0 = 1.0, b1 = 0.0, b2 = 0.0;
+        double a1 = 0.0, a2 = 0.0;
+    };
+
+    Coeffs getCoeffs() const noexcept { return { b0, b1, b2, a1, a2 }; }
+
+    void setCoeffs(const Coeffs& c) noexcept {
+        b0 = c.b0; b1 = c.b1; b2 = c.b2;
+        a1 = c.a1; a2 = c.a2;
+    }
+
+    // Pass-through: the zeros are put on the poles (b = a), so the filter is exactly the identity
+    // but keeps the poles of its family. A coefficient ramp from here toward a real design of the
+    // same curve then moves like any other parameter glide.
+    void makeIdentity() noexcept {
+        b0 = 1.0; b1 = a1; b2 = a2;
+    }
+
+    // True for makeIdentity() designs (and Coeffs{}), which the chains elide rather than run.
+    bool isIdentity() const noexcept {
+        return b0 == 1.0 && b1 == a1 && b2 == a2;
+    }
+
+    // Walks a serial chain back from its output history (h1 = last output, h2 = the one before)
+    // and loads every elided stage with the state it would hold had it run. An elided stage can
+    // then rejoin mid-stream (its coefficients ramping away from identity) without a step.
+    // For a one-sample block h2 is not needed: each elided stage just shifts its own history.
+    static void primeElidedStages(SimpleBiquad* const* chain, int count, double h1, double h2, int n) noexcept {
+        for (int k = count - 1; k >= 0; --k) {
+            SimpleBiquad& f = *chain[k];
+            if (f.isIdentity()) {
+                const double prev = (n > 1) ? h2 : f.x1;
+                f.x1 = f.y1 = h1;
+                f.x2 = f.y2 = prev;
+            }
+            else {
+                h1 = f.x1;
+                h2 = f.x2;
+            }
+        }
+    }
+
     // State
     double x1 = 0.0, x2 = 0.0;
     double y1 = 0.0, y2 = 0.0;
@@ -0,0 +1,189 @@
+/*
+  ==============================================================================
+    StateFormat.h
+    Compact binary plugin state (replaces the XML round trip for new sessions).
+    - Little-endian, versioned; parameter IDs are stored once so any table edit
+      can still be read back by name
+    - A matching schema hash skips the name lookup and reads values positionally
+    - Anything that does not start with the magic is left to the XML fallback
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <cmath>
+#include "ParameterTable.h"
+
+namespace MixBusState
+{
+    // Layout (all integers little-endian):
+    //   u32 magic  'NSMB'
+    //   u16 version
+    //   u16 count            number of parameters stored
+    //   u32 schemaHash       MixBusParams::schemaHash() of the writer
+    //   u32 idBytes          size of the ID block
+    //   ID block             count null-terminated IDs, in stored order
+    //   f32 values[count]    raw (denormalised) parameter values, in stored order
+    inline constexpr std::uint32_t magic = 0x424d534eu; // "NSMB" on disk
+    inline constexpr std::uint16_t version = 1;
+    inline constexpr int headerBytes = 16;
+
+    namespace Detail
+    {
+        inline void putU16(std::uint8_t* p, std::uint16_t v) noexcept
+        {
+            p[0] = (std::uint8_t)v; p[1] = (std::uint8_t)(v >> 8);
+        }
+
+        inline void putU32(std::uint8_t* p, std::uint32_t v) noexcept
+        {
+            p[0] = (std::uint8_t)v; p[1] = (std::uint8_t)(v >> 8); p[2] = (std::uint8_t)(v >> 16); p[3] = (std::uint8_t)(v >> 24);
+        }
+
+        inline std::uint16_t getU16(const std::uint8_t* p) noexcept
+        {
+            return (std::uint16_t)(p[0] | (p[1] << 8));
+        }
+
+        inline std::uint32_t getU32(const std::uint8_t* p) noexcept
+        {
+            return (std::uint32_t)p[0] | ((std::uint32_t)p[1] << 8) | ((std::uint32_t)p[2] << 16) | ((std::uint32_t)p[3] << 24);
+        }
+
+        inline void putF32(std::uint8_t* p, float v) noexcept
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, &v, sizeof(bits));
+            putU32(p, bits);
+        }
+
+        inline float getF32(const std::uint8_t* p) noexcept
+        {
+            const std::uint32_t bits = getU32(p);
+            float v;
+            std::memcpy(&v, &bits, sizeof(v));
+            return v;
+        }
+
+        constexpr int idBlockBytes()
+        {
+            int n = 0;
+            for (const auto& d : MixBusParams::table)
+                n += (int)std::char_traits<char>::length(d.id) + 1;
+            return n;
+        }
+
+        // Saved values pass through here, so a corrupt or hand-edited state can never push
+        // the DSP outside the ranges the table declares.
+        inline float sanitise(const MixBusParams::Descriptor& d, float v) noexcept
+        {
+            if (!std::isfinite(v))
+                return d.defaultValue;
+            return juce::jlimit(d.minValue, d.maxValue, v);
+        }
+    }
+
+    inline constexpr int idBytes = Detail::idBlockBytes();
+    inline constexpr int stateBytes = headerBytes + idBytes + MixBusParams::NumParams * 4;
+
+    inline void write(const MixBusParams::Snapshot& s, juce::MemoryBlock& dest)
+    {
+        using namespace Detail;
+
+        dest.setSize((size_t)stateBytes, false);
+        auto* p = static_cast<std::uint8_t*>(dest.getData());
+
+        putU32(p, magic);
+        putU16(p + 4, version);
+        putU16(p + 6, (std::uint16_t)MixBusParams::NumParams);
+        putU32(p + 8, MixBusParams::schemaHash());
+        putU32(p + 12, (std::uint32_t)idBytes);
+        p += headerBytes;
+
+        for (const auto& d : MixBusParams::table)
+        {
+            const size_t len = std::char_traits<char>::length(d.id) + 1;
+            std::memcpy(p, d.id, len);
+            p += len;
+        }
+
+        for (int i = 0; i < MixBusParams::NumParams; ++i, p += 4)
+            putF32(p, s.values[i]);
+    }
+
+    // Cheap check so callers can pick the binary or XML reader.
+    inline bool isBinaryState(const void* data, int sizeInBytes) noexcept
+    {
+        return data != nullptr && sizeInBytes >= headerBytes
+            && Detail::getU32(static_cast<const std::uint8_t*>(data)) == magic;
+    }
+
+    // Reads into `inOut`. Parameters missing from the state keep whatever `inOut` held
+    // (normally the current values); IDs this build does not know are skipped.
+    // Returns false, leaving `inOut` untouched, if the data is not a readable binary state.
+    inline bool read(const void* data, int sizeInBytes, MixBusParams::Snapshot& inOut)
+    {
+        using namespace Detail;
+
+        if (!isBinaryState(data, sizeInBytes))
+            return false;
+
+        const auto* p = static_cast<const std::uint8_t*>(data);
+
+        if (getU16(p + 4) > version)
+            return false;
+
+        const int count = getU16(p + 6);
+        const std::uint32_t hash = getU32(p + 8);
+        const std::uint32_t idBlock = getU32(p + 12);
+
+        if ((std::uint64_t)headerBytes + idBlock + (std::uint64_t)count * 4u > (std::uint64_t)sizeInBytes)
+            return false;
+
+        const auto* ids = p + headerBytes;
+        const auto* values = ids + idBlock;
+
+        MixBusParams::Snapshot s = inOut;
+
+        if (hash == MixBusParams::schemaHash() && count == MixBusParams::NumParams && (int)idBlock == idBytes)
+        {
+            for (int i = 0; i < count; ++i)
+                s.values[i] = sanitise(MixBusParams::table[i], getF32(values + i * 4));
+        }
+        else
+        {
+            // Different table: match by ID. The search starts where the previous match ended,
+            // so an appended-to table still costs one comparison per parameter.
+            const auto* id = ids;
+            int next = 0;
+
+            for (int i = 0; i < count; ++i)
+            {
+                const auto* term = static_cast<const std::uint8_t*>(std::memchr(id, 0, (size_t)(values - id)));
+                if (term == nullptr)
+                    return false;
+
+                const char* name = reinterpret_cast<const char*>(id);
+                for (int n = 0; n < MixBusParams::NumParams; ++n)
+                {
+                    const int j = (next + n) % MixBusParams::NumParams;
+                    if (MixBusParams::idsEqual(MixBusParams::table[j].id, name))
+                    {
+                        s.values[j] = sanitise(MixBusParams::table[j], getF32(values + i * 4));
+                        next = j + 1;
+                        break;
+                    }
+                }
+
+                id = term + 1;
+            }
+        }
+
+        inOut = s;
+        return true;
+    }
+}
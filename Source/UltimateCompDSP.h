@@ -19,7 +19,89 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
 #include "SimpleBiquad.h"
+#include "FilterDesignStage.h"
+#include "FixedVoicingCurves.h"
+#include "BlockRamp.h"
+#include "GainComputer.h"
+#include "Lookahead.h"
+#include "LatencyAlign.h"
+#include "OversamplingStage.h"
+#include "FastMath.h"
+#include "MixBusSimd.h"
+#include "ParameterTable.h"
+
+// ==============================================================================
+// DIRTY TRACKING
+// UltimateCompDSP::updateParameters() only redesigns the groups whose inputs changed.
+// Parameters consumed per sample or per chunk (threshold, ratio, bypasses, ...) belong to no group.
+// ==============================================================================
+namespace MixBusDirty
+{
+    enum Group : std::uint32_t
+    {
+        Fixed      = 1u << 0,  // sample-rate constants (prepare only)
+        Timing     = 1u << 1,
+        Rms        = 1u << 2,
+        Link       = 1u << 3,
+        CompGains  = 1u << 4,
+        ScHpf      = 1u << 5,
+        ScLpf      = 1u << 6,
+        Thrust     = 1u << 7,
+        ScTd       = 1u << 8,
+        Crest      = 1u << 9,
+        TpFlux     = 1u << 10,
+        SatTone    = 1u << 11,
+        Girth      = 1u << 12,
+        Harm       = 1u << 13,
+        SatGains   = 1u << 14,
+        Output     = 1u << 15,
+        DetRate    = 1u << 16,
+        OsRate     = 1u << 17, // oversampled-rate constants (Quality mode switch)
+        Designed   = ScHpf | ScLpf | SatTone | Girth | Harm, // handed to FilterDesignStage
+        All        = 0xffffffffu
+    };
+
+    constexpr std::uint32_t groupsFor(int index) noexcept
+    {
+        using P = MixBusParams::Index;
+        switch (index)
+        {
+        case P::att_ms: case P::rel_ms: case P::turbo_att: case P::turbo_rel:        return Timing;
+        case P::det_rms:                                                             return Rms;
+        case P::stereo_link: case P::fb_blend:                                       return Link;
+        case P::comp_input: case P::makeup: case P::sc_level_db: case P::ms_balance: return CompGains;
+        case P::sc_hp_freq:                                                          return ScHpf;
+        case P::sc_lp_freq:                                                          return ScLpf;
+        case P::thrust_mode:                                                         return Thrust;
+        case P::sc_td_amt: case P::sc_td_ms:                                         return ScTd;
+        case P::crest_target: case P::crest_speed:                                   return Crest;
+        case P::tp_mode: case P::tp_amount: case P::tp_thresh_raise:
+        case P::flux_mode: case P::flux_amount: case P::cl_rate:                     return TpFlux;
+        case P::sat_tone: case P::sat_tone_freq:                                     return SatTone;
+        case P::girth: case P::girth_freq:                                           return Girth;
+        case P::harm_bright: case P::harm_freq:                                      return Harm;
+        case P::sat_pre_gain: case P::sat_drive: case P::sat_mix: case P::sat_trim:  return SatGains;
+        case P::in_gain: case P::out_trim: case P::stuff_bal:                        return Output;
+        case P::det_rate:                                                            return DetRate;
+        default:                                                                     return 0u;
+        }
+    }
+
+    constexpr std::array<std::uint32_t, MixBusParams::NumParams> makeMap() noexcept
+    {
+        std::array<std::uint32_t, MixBusParams::NumParams> m{};
+        for (int i = 0; i < MixBusParams::NumParams; ++i)
+            m[(size_t)i] = groupsFor(i);
+        return m;
+    }
+
+    inline constexpr auto map = makeMap();
+}
 
 class UltimateCompDSP
 {
@@ -34,6 +116,7 @@ public:
     int   p_signal_flow = 0; // 0 = Comp > Sat, 1 = Sat > Comp
     float p_global_in = 0.0f;  // Global Input Gain (dB)
     float p_global_out = 0.0f; // Global Output Gain (dB)
+    float p_in_gain = 0.0f;    // Input Gain (dB), main bus only, metered
 
     // --- MODULE BYPASS STATES ---
     bool p_active_dyn = true;
@@ -84,6 +167,8 @@ public:
     float p_sc_hp_freq = 20.0f;
     float p_sc_lp_freq = 20000.0f;
     float p_fb_blend = 0.0f;
+    int   p_det_rate = 0;       // 0 = full rate, 1 = control rate (see MULTIRATE DETECTOR)
+    float p_lookahead = 0.0f;   // ms, 0 = off (see LOOKAHEAD)
     float p_sc_level_db = 0.0f; // Sidechain Level Trim (dB)
     bool  p_sc_audition = false; // Monitor detector feed
 
@@ -99,9 +184,11 @@ public:
     // --- FLUX COUPLED ---
     int   p_flux_mode = 0;
     float p_flux_amount = 30.0f;
+    int   p_cl_rate = 2;            // 0 = every detector step, else 4 / 2 / 1 kHz (see CONTROL LAYER)
 
     // --- SATURATION ---
     int   p_sat_mode = 0;
+    int   p_quality_mode = 1;   // 0 = Live, 1 = Mix, 2 = Master (see QUALITY MODES)
     float p_sat_pre_gain = 0.0f;
     bool  p_sat_mirror = false;
     float p_sat_drive = 0.0f;
@@ -129,99 +216,272 @@ public:
     float p_dry_wet = 100.0f;
     float p_out_trim = 0.0f;
 
+    // ==============================================================================
+    // PARAMETER SNAPSHOT
+    // The processor copies every raw host value into a MixBusParams::Snapshot once per
+    // block; this is the only place those values are decoded into the typed fields above.
+    // ==============================================================================
+    using ParameterSnapshot = MixBusParams::Snapshot;
+
+    void setParameters(const ParameterSnapshot& s) noexcept
+    {
+        using P = MixBusParams::Index;
+
+        // Flag the coefficient groups fed by any value that moved since the last snapshot.
+        std::uint32_t changed = 0;
+        for (int i = 0; i < MixBusParams::NumParams; ++i)
+            changed |= (s.values[i] != last_snapshot.values[i]) ? MixBusDirty::map[(size_t)i] : 0u;
+        dirty_groups |= changed;
+        last_snapshot = s;
+
+        // Offline render profile (see RENDER PROFILE): overrides the rate settings below
+        const bool upgrade = renderUpgradeFor(s);
+        if (upgrade != render_upgrade)
+        {
+            render_upgrade = upgrade;
+            dirty_groups |= MixBusDirty::DetRate | MixBusDirty::TpFlux;
+        }
+
+        // Global
+        p_in_gain = s.get(P::in_gain);
+        // Compressor
+        p_thresh = s.get(P::thresh);
+        p_ratio = s.get(P::ratio);
+        p_knee = s.get(P::knee);
+        p_att_ms = s.get(P::att_ms);
+        p_rel_ms = s.get(P::rel_ms);
+        p_makeup = s.get(P::makeup);
+        // Compressor Auto-Gain
+        p_comp_autogain_mode = s.getChoice(P::comp_autogain);
+        // Comp Input / Mirror
+        p_comp_input = s.get(P::comp_input);
+        p_comp_mirror = s.getBool(P::comp_mirror);
+        p_dry_wet = s.get(P::dry_wet);
+        p_out_trim = s.get(P::out_trim);
+        p_auto_rel = s.getChoice(P::auto_rel);
+        p_signal_flow = s.getChoice(P::signal_flow);
+        p_turbo_att = s.getBool(P::turbo_att);
+        p_turbo_rel = s.getBool(P::turbo_rel);
+        // Bypass
+        p_active_dyn = s.getBool(P::active_dyn);
+        p_active_det = s.getBool(P::active_det);
+        p_active_crest = s.getBool(P::active_crest);
+        p_active_tf = s.getBool(P::active_tf);
+        p_active_sat = s.getBool(P::active_sat);
+        p_active_eq = s.getBool(P::active_eq);
+        // Sidechain
+        p_sc_input_mode = s.getChoice(P::sc_mode);
+        p_ms_mode = s.getChoice(P::ms_mode);
+        p_ms_balance_db = s.get(P::ms_balance);
+        // SC Routing
+        p_sc_to_comp = s.getBool(P::sc_to_comp);
+        // Detector
+        p_ctrl_mode = s.getChoice(P::ctrl_mode);
+        p_crest_target = s.get(P::crest_target);
+        p_crest_speed = s.get(P::crest_speed);
+        p_thrust_mode = s.getChoice(P::thrust_mode);
+        p_det_rms = s.get(P::det_rms);
+        p_stereo_link = s.get(P::stereo_link);
+        p_sc_hp_freq = s.get(P::sc_hp_freq);
+        p_sc_lp_freq = s.get(P::sc_lp_freq);
+        p_fb_blend = s.get(P::fb_blend);
+        p_det_rate = render_upgrade ? 0 : s.getChoice(P::det_rate);
+        p_lookahead = s.get(P::lookahead);
+        p_sc_level_db = s.get(P::sc_level_db);
+        p_sc_audition = s.getBool(P::sc_audition);
+        p_sc_td_amt = s.get(P::sc_td_amt);
+        p_sc_td_ms = s.get(P::sc_td_ms);
+        // Transient/Flux
+        p_tp_mode = s.getChoice(P::tp_mode);
+        p_tp_amount = s.get(P::tp_amount);
+        p_tp_thresh_raise = s.get(P::tp_thresh_raise);
+        p_flux_mode = s.getChoice(P::flux_mode);
+        p_flux_amount = s.get(P::flux_amount);
+        p_cl_rate = render_upgrade ? 0 : s.getChoice(P::cl_rate);
+        // Saturation
+        p_sat_mode = s.getChoice(P::sat_mode);
+        p_quality_mode = qualityModeFor(s, render_upgrade);
+        p_sat_pre_gain = s.get(P::sat_pre_gain);
+        p_sat_mirror = s.getBool(P::sat_mirror);
+        p_sat_drive = s.get(P::sat_drive);
+        p_sat_trim = s.get(P::sat_trim);
+        p_sat_mix = s.get(P::sat_mix);
+        p_sat_autogain_mode = s.getChoice(P::sat_autogain);
+        // EQ
+        p_sat_tone = s.get(P::sat_tone);
+        p_sat_tone_freq = s.get(P::sat_tone_freq);
+        p_harm_bright = s.get(P::harm_bright);
+        p_harm_freq = s.get(P::harm_freq);
+        // Mojo
+        p_mojo = s.getBool(P::stuff);
+        p_mojo_balance = s.get(P::stuff_bal);
+        // Color EQ: Pultec-style low-end
+        p_girth = s.get(P::girth);
+        p_girth_freq_sel = s.getChoice(P::girth_freq);
+        // DEBUGGING
+        p_debug_boost_q = s.get(P::dbg_bq);
+        p_debug_dip_q = s.get(P::dbg_dq);
+        p_debug_ratio = s.get(P::dbg_rat);
+    }
+
     // ==============================================================================
     // GETTERS
     // ==============================================================================
     float getGainReductiondB() const { return (float)env; }
+    // Deepest / shallowest gain reduction seen during the last process() call (dB, <= 0).
+    float getGainReductionMindB() const { return (float)(gr_block_lo <= gr_block_hi ? gr_block_lo : env); }
+    float getGainReductionMaxdB() const { return (float)(gr_block_lo <= gr_block_hi ? gr_block_hi : env); }
     float getFluxSaturation() const { return (float)flux_env; }
     float getCrestAmt() const { return (float)cf_amt; }
 
-    // Latency is only incurred when the Sat/EQ oversampled block is active.
-    double getLatency() const { return (p_active_sat ? (double)os_latency_samples : 0.0); }
+    // Fixed by the running Quality mode and Lookahead alone: with Saturation off its path is
+    // delayed to match (see QUALITY MODES), so toggling modules never moves the host's compensation.
+    // After a mode change it follows once the new oversampler is in.
+    double getLatency() const
+    {
+        return (double)os_latency_samples + (double)lookaheadSamples();
+    }
+
+    // Lookahead length in samples for the current setting (0 when off).
+    int lookaheadSamples() const noexcept
+    {
+        return juce::jlimit(0, la_max_samples, (int)std::lround((double)p_lookahead * 0.001 * s_rate));
+    }
+
+    // Input meter values for the last process() call (post Input Gain, pre Global Input).
+    float getInputPeak(int channel) const noexcept { return input_level[channel & 1].peak; }
+    float getInputRms(int channel) const noexcept { return input_level[channel & 1].rms(); }
+
+    // Output meter values for the last process() call. A mono bus reports its only channel twice.
+    float getOutputPeak(int channel) const noexcept { return output_level[outputMeterChannel(channel)].peak; }
+    float getOutputRms(int channel) const noexcept { return output_level[outputMeterChannel(channel)].rms(); }
+
+    // The host's offline-render state. Any thread; the render profile needs a prepare() after
+    // it to start (see RENDER PROFILE).
+    void setNonRealtime(bool isNonRealtime) noexcept
+    {
+        offline_render.store(isNonRealtime, std::memory_order_relaxed);
+    }
+
+    // Register this with a FilterDesignThread, then enable async design. Without a worker
+    // (or with it disabled) the automatable curves are designed inline as before.
+    FilterDesignStage& getFilterDesignStage() noexcept { return filter_design; }
+
+    // Register this with the same worker: it builds the oversampler for a new Quality mode.
+    OversamplingStage& getOversamplingStage() noexcept { return os_stage; }
+
+    void setAsyncFilterDesign(bool shouldUseWorker) noexcept
+    {
+        async_filter_design.store(shouldUseWorker, std::memory_order_relaxed);
+    }
 
     // ==============================================================================
     // LIFECYCLE
     // ==============================================================================
 
-    void prepare(double sampleRate, int maxBlockSamples)
+    // Bus width limits: channels 0 / 1 are the front L / R pair the stereo engine runs on,
+    // anything after them is the surround bed (see SURROUND BED).
+    static constexpr int maxChannels = 16;
+
+    // Quality modes: Live, Mix, Master (see QUALITY MODES).
+    static constexpr int numQualityModes = OversamplingPath::numModes;
+
+    // numChannels is the main bus width; lfeChannel the LFE's index on it, or -1 for none.
+    void prepare(double sampleRate, int maxBlockSamples, int numChannels = 2, int lfeChannel = -1)
     {
         s_rate = (sampleRate > 1.0 ? sampleRate : 44100.0);
         max_block = std::max(1, maxBlockSamples);
 
-        // Prepare Oversampling (fixed 4x)
-        os_stages = 2;
-        os_factor = 1 << os_stages;
+        // The render profile is only taken up here (see RENDER PROFILE)
+        render_armed = offline_render.load(std::memory_order_relaxed);
+        setParameters(last_snapshot);
+        num_channels = juce::jlimit(2, maxChannels, numChannels);
+        lfe_channel = (lfeChannel >= 2 && lfeChannel < num_channels) ? lfeChannel : -1;
 
-        dry_buf.setSize(2, max_block, false, false, true);
-        wet_buf.setSize(2, max_block, false, false, true);
+        dry_buf.setSize(num_channels, max_block, false, false, true);
+        wet_buf.setSize(num_channels, max_block, false, false, true);
         sc_internal_buf.setSize(2, max_block, false, false, true);
+        sc_det_l.assign((size_t)max_block, 0.0);
+        sc_det_r.assign((size_t)max_block, 0.0);
 
         // Work buffers are base-rate; Oversampling maintains its own internal up/down buffers.
-        sat_clean_buf.setSize(2, max_block, false, false, true);
-        sat_proc_buf.setSize(2, max_block, false, false, true);
+        sat_clean_buf.setSize(num_channels, max_block, false, false, true);
+        sat_proc_buf.setSize(num_channels, max_block, false, false, true);
 
         // Mojo parallel buffer
         mojo_buf.setSize(2, max_block, false, false, true);
 
-        os = std::make_unique<juce::dsp::Oversampling<float>>(
-            2, os_stages, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true);
-        os->initProcessing((size_t)max_block);
-
-        os_dry = std::make_unique<juce::dsp::Oversampling<float>>(
-            2, os_stages, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true);
-        os_dry->initProcessing((size_t)max_block);
-
-        // Cache oversampling latency for host reporting
-        os_latency_samples = (int)os->getLatencyInSamples();
-
-        juce::dsp::ProcessSpec spec;
-        spec.sampleRate = s_rate;
-        spec.maximumBlockSize = (juce::uint32)max_block;
-        spec.numChannels = 2;
-
-        satInternalDelay.prepare(spec);
-        satInternalDelay.reset();
+        sat_ch.assign((size_t)num_channels, SatChannel{});
+
+        const int bed = num_channels - 2;
+        sc_bed.assign((size_t)(bed + (bed & 1)), ScBedChannel{});
+        sc_bed_buf.assign(bed > 0 ? (size_t)max_block * 2 : 0, 0.0);
+        sc_det_bed.assign(bed > 0 ? (size_t)max_block : 0, 0.0);
+        bed_gain.assign(bed > 0 ? (size_t)max_block : 0, 1.0);
+
+        // The LFE never reaches the nonlinearity, so it is not oversampled either.
+        const int satChannels = num_channels - (lfe_channel >= 0 ? 1 : 0);
+        sat_os_channels.assign((size_t)satChannels, nullptr);
+
+        // Only the current Quality mode's oversampler is built; another mode is built on the
+        // worker when asked for (see QUALITY MODES)
+        os_stage.configure(satChannels, max_block, LatencyAligner::maxTaps);
+        os_path = OversamplingPath::build(p_quality_mode, satChannels, max_block, LatencyAligner::maxTaps);
+
+        // Paths running parallel to the oversampler line up with it through delays (see LATENCY
+        // ALIGNMENT). Every mode's latency fits inside the FIR history, so one size serves all.
+        dry_align.prepare(num_channels, max_block, LatencyAligner::maxTaps - 1);
+        sat_align.prepare(num_channels, max_block, LatencyAligner::maxTaps - 1);
+        audition_align.prepare(num_channels, max_block, LatencyAligner::maxTaps - 1);
+        selectQualityMode();
+
+        // Lookahead: the detector window spans the delay plus the current sample
+        la_max_samples = (int)std::ceil((double)maxLookaheadMs * 0.001 * s_rate);
+        la_det_l.prepare(la_max_samples + 1);
+        la_det_r.prepare(la_max_samples + 1);
+        la_det_bed.prepare(la_max_samples + 1);
+        la_wet.prepare(num_channels, la_max_samples);
+        la_dry.prepare(num_channels, la_max_samples);
 
         // Pre-size RMS ring buffer (max 300 ms) so detector window changes never allocate on the audio thread.
         rms_window_max = juce::jmax(1, (int)std::ceil(0.300 * s_rate));
-        rms_ring_l.assign((size_t)rms_window_max, 0.0);
-        rms_ring_r.assign((size_t)rms_window_max, 0.0);
+        rms_ring.assign((size_t)rms_window_max * 2, 0.0f);
         rms_window = 1;
         rms_pos = 0;
-        rms_sum_l = rms_sum_r = 0.0;
+        rms_sum_lr = rms_lap_lr = Double2::broadcast(0.0);
+
+        applyFixedVoicingCurves(fixed_curve_store->get(s_rate));
 
+        smooth_alpha_block_len = -1;
         resetState();
+        dirty_groups = MixBusDirty::All;
         updateParameters();
+        comp_ramps.prepare(max_block, smooth_alpha);
     }
 
     // Safe to call from the message thread (e.g., releaseResources) to clear DSP state.
     void reset() noexcept
     {
         if (os) os->reset();
-        if (os_dry) os_dry->reset();
-
-        satInternalDelay.reset();
+        resetLatencyAlignment();
         resetState();
     }
 
 
     void resetState()
     {
-        // Filters
-        sc_hp_l.reset(); sc_hp_r.reset(); sc_hp_l_2.reset(); sc_hp_r_2.reset();
-        sc_lp_l.reset(); sc_lp_r.reset(); sc_lp_l_2.reset(); sc_lp_r_2.reset();
-        sat_tone_l.reset(); sat_tone_r.reset();
-        girth_bump_l.reset(); girth_bump_r.reset(); girth_dip_l.reset(); girth_dip_r.reset();
-        harm_pre_l.reset(); harm_pre_r.reset(); harm_post_l.reset(); harm_post_r.reset();
-        iron_voicing_l.reset(); iron_voicing_r.reset();
-        steel_low_l.reset(); steel_low_r.reset(); steel_high_l.reset(); steel_high_r.reset();
+        // Filters (state only: designs survive a reset, so nothing is redesigned on the audio thread)
+        sc_hp_l.resetState(); sc_hp_r.resetState(); sc_hp_l_2.resetState(); sc_hp_r_2.resetState();
+        sc_lp_l.resetState(); sc_lp_r.resetState(); sc_lp_l_2.resetState(); sc_lp_r_2.resetState();
+        for (auto& c : sat_ch) c.resetState();
+        for (auto& c : sc_bed) { c.hp.resetState(); c.hp_2.resetState(); c.lp.resetState(); c.lp_2.resetState(); c.shelf.resetState(); }
 
         // MOJO (parallel 'magic sauce') filters/state
-        mojo_hp_l.reset(); mojo_hp_r.reset();
-        mojo_low_shelf_l.reset(); mojo_low_shelf_r.reset();
-        mojo_dip_l.reset(); mojo_dip_r.reset();
-        mojo_hi_shelf_l.reset(); mojo_hi_shelf_r.reset();
-        mojo_lp_l.reset(); mojo_lp_r.reset();
+        mojo_hp_l.resetState(); mojo_hp_r.resetState();
+        mojo_low_shelf_l.resetState(); mojo_low_shelf_r.resetState();
+        mojo_dip_l.resetState(); mojo_dip_r.resetState();
+        mojo_hi_shelf_l.resetState(); mojo_hi_shelf_r.resetState();
+        mojo_lp_l.resetState(); mojo_lp_r.resetState();
 
         mojo_on_sm = 0.0;
         mojo_prev_on = false;
@@ -233,11 +493,8 @@ public:
         mojo_dc_x1_r = mojo_dc_y1_r = 0.0;
 
         if (os) os->reset();
-        if (os_dry) os_dry->reset();
-        satInternalDelay.reset();
+        resetLatencyAlignment();
 
-        steel_phi_l = steel_phi_r = 0.0;
-        steel_prev_x_l = steel_prev_x_r = 0.0;
         sat_agc_gain_sm = 1.0;
         sc_level_sm = 1.0;
         ms_bal_sm = 1.0;
@@ -254,12 +511,12 @@ public:
         fb_prev_l = fb_prev_r = 0.0;
         det_env = 0.0;
         env = 0.0;
-        env_l = env_r = 0.0;
+        env_lr = env_fast_lr = env_slow_lr = Double2::broadcast(0.0);
         env_fast = env_slow = 0.0;
-        env_fast_l = env_fast_r = 0.0;
-        env_slow_l = env_slow_r = 0.0;
+        resetControlRateState();
         cf_peak_env = 0.0; cf_rms_sum = 0.0; cf_amt = 0.0; cf_ratio_mix = 0.0;
         flux_env = 0.0;
+        resetControlLayerState();
 
         // Auto-Gain States
         comp_agc_gain_sm = 1.0;
@@ -288,6 +545,8 @@ public:
         prevTopoMsMode = p_ms_mode;
         prevTopoScMode = p_sc_input_mode;
         prevTopoScToComp = p_sc_to_comp;
+        prevTopoLookahead = lookaheadSamples();
+        resetLookahead(prevTopoLookahead);
     }
 
 
@@ -307,6 +566,13 @@ public:
         const int msMode = p_ms_mode;
         const int scMode = p_sc_input_mode;
         const bool scToComp = p_sc_to_comp;
+        const int lookahead = lookaheadSamples();
+
+        // A new Quality mode waits for its oversampler from the worker, then swaps in like any
+        // other topology change
+        const int quality = p_quality_mode;
+        os_stage.request(quality != active_quality_mode ? quality : -1);
+        const bool qualitySwap = (quality != active_quality_mode) && os_stage.exchange(quality, os_path);
 
         const bool changed =
             (satEq != prevTopoSatEq) ||
@@ -314,15 +580,26 @@ public:
             (flow != prevTopoFlow) ||
             (msMode != prevTopoMsMode) ||
             (scMode != prevTopoScMode) ||
-            (scToComp != prevTopoScToComp);
+            (scToComp != prevTopoScToComp) ||
+            (lookahead != prevTopoLookahead) ||
+            qualitySwap;
 
         if (!changed) return;
 
+        // A new Quality mode swaps the oversampler; the oversampled-rate state restarts with it.
+        if (qualitySwap)
+        {
+            selectQualityMode();
+            for (auto& c : sat_ch) c.resetState();
+        }
+
         // Reset latency-matching paths and oversampling state; then fade the wet contribution back in.
         if (os) os->reset();
-        if (os_dry) os_dry->reset();
+        resetLatencyAlignment();
 
-        satInternalDelay.reset();
+        // A new lookahead length is a new latency: restart both delays and the detector windows.
+        if (lookahead != prevTopoLookahead)
+            resetLookahead(lookahead);
 
         // Reset detector-conditioning state on SC-related topology changes.
         if ((audition != prevTopoAudition) || (msMode != prevTopoMsMode) || (scMode != prevTopoScMode) || (scToComp != prevTopoScToComp))
@@ -336,15 +613,26 @@ public:
         prevTopoMsMode = msMode;
         prevTopoScMode = scMode;
         prevTopoScToComp = scToComp;
+        prevTopoLookahead = lookahead;
     }
 
     void process(juce::AudioBuffer<float>& buffer, const juce::AudioBuffer<float>* sidechainBuffer = nullptr)
     {
         juce::ScopedNoDenormals noDenormals;
 
+        input_level[0].clear();
+        input_level[1].clear();
+        output_level[0].clear();
+        output_level[1].clear();
+        gr_block_lo = std::numeric_limits<double>::max();
+        gr_block_hi = std::numeric_limits<double>::lowest();
+
         const int totalSamples = buffer.getNumSamples();
         if (totalSamples <= 0) return;
 
+        // Front pair plus whatever of the prepared bed the host actually delivered
+        const int numCh = juce::jlimit(2, num_channels, buffer.getNumChannels());
+
         // If the host ever delivers a larger-than-expected block, we process it in fixed-size chunks
         // so we never need to resize/allocate on the audio thread.
         const int chunkSize = juce::jmax(1, max_block);
@@ -358,7 +646,11 @@ public:
             const int nSamp = juce::jmin(chunkSize, totalSamples - offset);
 
             // Update coefficients and control values for this chunk.
-            smooth_alpha_block = std::exp(-(double)nSamp / (0.020 * s_rate));
+            if (nSamp != smooth_alpha_block_len)
+            {
+                smooth_alpha_block = std::exp(-(double)nSamp / (0.020 * s_rate));
+                smooth_alpha_block_len = nSamp;
+            }
             updateParameters();
 
             // Smooth Global Gains
@@ -367,28 +659,35 @@ public:
             mojo_mix_sm = smooth1p(mojo_mix_sm, mojo_mix_target, smooth_alpha_block);
 
             // 1) Snapshot Input for Dry/Wet mix later (chunk)
-            // Apply Global Input Gain to the COPY source so it propagates to wet/dry/sc buffers
-            dry_buf.setSize(2, nSamp, false, false, true);
-            wet_buf.setSize(2, nSamp, false, false, true);
+            // Input Gain (main bus only) and Global Input Gain are applied to the COPY source
+            // so they propagate to wet/dry/sc buffers
+            dry_buf.setSize(numCh, nSamp, false, false, true);
+            wet_buf.setSize(numCh, nSamp, false, false, true);
             sc_internal_buf.setSize(2, nSamp, false, false, true);
 
             const float* inL = buffer.getReadPointer(0) + offset;
             const float* inR = (buffer.getNumChannels() > 1) ? (buffer.getReadPointer(1) + offset) : inL;
 
             const float gIn = (float)global_in_sm;
-
-            // Copy with Gain
-            for (int i = 0; i < nSamp; ++i) {
-                float l = inL[i] * gIn;
-                float r = inR[i] * gIn;
-                dry_buf.setSample(0, i, l);
-                dry_buf.setSample(1, i, r);
-                wet_buf.setSample(0, i, l);
-                wet_buf.setSample(1, i, r);
-            }
+            const bool externalSc = (p_sc_input_mode == 1 && sidechainBuffer != nullptr && sidechainBuffer->getNumChannels() > 0);
+            sc_external_live = externalSc;
+
+            // Single pass per channel: input gain (metered here), global input gain, then
+            // dry / wet / internal-sidechain copies.
+            MixBusSimd::gainMeterCopy(inL, in_gain_lin, gIn,
+                dry_buf.getWritePointer(0), wet_buf.getWritePointer(0),
+                externalSc ? nullptr : sc_internal_buf.getWritePointer(0), nSamp, input_level[0]);
+            MixBusSimd::gainMeterCopy(inR, in_gain_lin, gIn,
+                dry_buf.getWritePointer(1), wet_buf.getWritePointer(1),
+                externalSc ? nullptr : sc_internal_buf.getWritePointer(1), nSamp, input_level[1]);
+
+            // Bed channels: the dry copy doubles as their internal key (see conditionBedSidechain)
+            for (int ch = 2; ch < numCh; ++ch)
+                MixBusSimd::gainMeterCopy(buffer.getReadPointer(ch) + offset, in_gain_lin, gIn,
+                    dry_buf.getWritePointer(ch), wet_buf.getWritePointer(ch), nullptr, nSamp);
 
             // 2) Prepare Sidechain Buffer (chunk)
-            if (p_sc_input_mode == 1 && sidechainBuffer != nullptr && sidechainBuffer->getNumChannels() > 0)
+            if (externalSc)
             {
                 const float* scL = sidechainBuffer->getReadPointer(0) + offset;
                 const float* scR = (sidechainBuffer->getNumChannels() > 1) ? (sidechainBuffer->getReadPointer(1) + offset) : scL;
@@ -396,11 +695,6 @@ public:
                 sc_internal_buf.copyFrom(0, 0, scL, nSamp);
                 sc_internal_buf.copyFrom(1, 0, scR, nSamp);
             }
-            else
-            {
-                sc_internal_buf.copyFrom(0, 0, dry_buf, 0, 0, nSamp);
-                sc_internal_buf.copyFrom(1, 0, dry_buf, 1, 0, nSamp);
-            }
 
             // 3) Processing Chain (on wet_buf)
             if (p_sc_audition)
@@ -410,13 +704,8 @@ public:
                 processAuditionBlock(wet_buf);
 
                 // Preserve oversampling latency behavior so toggling audition does not change timing.
-                if (p_active_sat && os)
-                {
-                    auto block = juce::dsp::AudioBlock<float>(wet_buf);
-                    auto osBlock = os->processSamplesUp(block);
-                    (void)osBlock;
-                    os->processSamplesDown(block);
-                }
+                if (os)
+                    audition_align.process(wet_buf.getArrayOfWritePointers(), numCh, nSamp, false);
             }
             else
             {
@@ -433,16 +722,21 @@ public:
             }
 
             // 4) Latency Compensation for DRY signal
-            // If Saturation/EQ block ran, the wet signal is delayed by OS.
-            // We must delay the dry signal to match.
-            if (p_active_sat && os && os_dry)
+            // The wet signal is always delayed by the mode's OS latency (through the oversampler,
+            // or a plain delay while Saturation is off). We must delay the dry signal to match.
+            const double dw_target = p_sc_audition ? 1.0 : juce::jlimit(0.0, 1.0, (double)p_dry_wet / 100.0);
+            if (os)
             {
-                auto block = juce::dsp::AudioBlock<float>(dry_buf);
-                auto osBlock = os_dry->processSamplesUp(block);
-                (void)osBlock;
-                os_dry->processSamplesDown(block);
+                // Phase-matched while the dry is heard against the oversampled path: below 100% wet,
+                // during a topology fade, or as Mojo's source
+                const bool dryHeard = dw_target < 1.0 || (float)drywet_sm < 1.0f || topologyRamp < 1.0
+                                   || p_mojo || mojo_on_sm > 0.001;
+                dry_align.process(dry_buf.getArrayOfWritePointers(), numCh, nSamp, p_active_sat && dryHeard);
             }
 
+            // ...and by the compressor's lookahead (see LOOKAHEAD)
+            la_dry.process(dry_buf.getArrayOfWritePointers(), numCh, nSamp);
+
             // 4.5) Process Mojo Parallel Chain (using the latency-compensated dry_buf)
             if (mojo_on_sm > 0.001)
             {
@@ -450,11 +744,9 @@ public:
             }
 
             // 5) Final Mixer (write into the output buffer segment)
-            const double dw_target = p_sc_audition ? 1.0 : juce::jlimit(0.0, 1.0, (double)p_dry_wet / 100.0);
             drywet_sm = smooth1p(drywet_sm, dw_target, smooth_alpha_block);
 
-            const double final_gain_target = dbToLin((double)p_out_trim);
-            out_lin_sm = smooth1p(out_lin_sm, final_gain_target, smooth_alpha_block);
+            out_lin_sm = smooth1p(out_lin_sm, out_lin_target, smooth_alpha_block);
             const float finalGain = (float)out_lin_sm;
             const float gOut = (float)global_out_sm;
 
@@ -470,14 +762,24 @@ public:
 
             const float mojoMix = (float)(mojo_on_sm * mojo_mix_sm);
 
-            const double mojoLevelTarget = dbToLin((double)p_mojo_balance);
-            mojo_level_sm = smooth1p(mojo_level_sm, mojoLevelTarget, smooth_alpha_block);
+            mojo_level_sm = smooth1p(mojo_level_sm, mojo_level_target, smooth_alpha_block);
             const float mojoGain = (float)mojo_level_sm;
 
-            for (int i = 0; i < nSamp; ++i)
+            // Per-block scalars for the fused mixer; the mojo send only exists while mojo is audible.
+            const float outGain = finalGain * gOut;
+            const float mojoSend = mojoMix * mojoGain;
+            const bool useMojo = (mojoMix > 0.0f);
+
+            // Bed first: it replays the topology ramp from where the front pair starts it
+            for (int ch = 2; ch < numCh; ++ch)
+                mixBedChannel(buffer.getWritePointer(ch) + offset, wet_buf.getReadPointer(ch),
+                              dry_buf.getReadPointer(ch), outGain, nSamp);
+
+            // Topology-change ramp: short per-sample prologue, then constant wet/dry for the rest.
+            int i = 0;
+            for (; i < nSamp && topologyRamp < 1.0; ++i)
             {
-                if (topologyRamp < 1.0)
-                    topologyRamp = std::min(1.0, topologyRamp + topologyInc);
+                topologyRamp = std::min(1.0, topologyRamp + topologyInc);
 
                 const float wm = (float)(drywet_sm * topologyRamp);
                 const float dm = 1.0f - wm;
@@ -485,15 +787,30 @@ public:
                 float sigL = (wetL[i] * wm + dryL[i] * dm);
                 float sigR = (wetR[i] * wm + dryR[i] * dm);
 
-                if (mojoMix > 0.0f) {
-                    // APPLY GAIN HERE instead of Balance
-                    sigL += mojoL[i] * mojoMix * mojoGain;
-                    sigR += mojoR[i] * mojoMix * mojoGain;
+                if (useMojo) {
+                    sigL += mojoL[i] * mojoSend;
+                    sigR += mojoR[i] * mojoSend;
                 }
 
-                outL[i] = sigL * finalGain * gOut;
+                outL[i] = sigL * outGain;
+                output_level[0].addSample(outL[i]);
+                if (outR) {
+                    outR[i] = sigR * outGain;
+                    output_level[1].addSample(outR[i]);
+                }
+            }
+
+            if (i < nSamp)
+            {
+                const float wm = (float)drywet_sm;
+                const float dm = 1.0f - wm;
+                const int n = nSamp - i;
+
+                MixBusSimd::mixMeter(wetL + i, dryL + i, useMojo ? mojoL + i : nullptr,
+                                     wm, dm, mojoSend, outGain, outL + i, n, output_level[0]);
                 if (outR)
-                    outR[i] = sigR * finalGain * gOut;
+                    MixBusSimd::mixMeter(wetR + i, dryR + i, useMojo ? mojoR + i : nullptr,
+                                         wm, dm, mojoSend, outGain, outR + i, n, output_level[1]);
             }
 
             offset += nSamp;
@@ -502,135 +819,206 @@ public:
 
     void updateParameters()
     {
-        const double attMul = (p_turbo_att ? 0.1 : 1.0);
-        const double relMul = (p_turbo_rel ? 0.1 : 1.0);
-        const double att_ms = std::max(0.05, (double)p_att_ms * attMul);
-        const double rel_ms = std::max(1.0, (double)p_rel_ms * relMul);
-
-        att_coeff = std::exp(-1000.0 / (att_ms * s_rate));
-        rel_coeff_manual = std::exp(-1000.0 / (rel_ms * s_rate));
-        auto_rel_slow = std::exp(-1000.0 / (1200.0 * s_rate));
-        auto_rel_fast = std::exp(-1000.0 / (80.0 * s_rate));
-
-        use_rms = (p_det_rms > 0.0f);
-        if (use_rms) {
-            const double win_ms = std::max(1.0, (double)p_det_rms);
-            const int desired = std::max(1, (int)std::round((win_ms * 0.001) * s_rate));
-            const int clamped = std::min(desired, rms_window_max);
-            if (clamped != rms_window)
+        // Only the coefficient groups whose parameters moved since the last call are redesigned.
+        std::uint32_t dirty = dirty_groups;
+        dirty_groups = 0;
+
+        // --- SAMPLE-RATE CONSTANTS (prepare only; the fixed voicing curves come from FixedVoicingCurveStore) ---
+        if (dirty & MixBusDirty::Fixed)
+        {
+            sc_td_fast_att = std::exp(-1000.0 / (1.0 * s_rate));
+            sc_td_fast_rel = std::exp(-1000.0 / (30.0 * s_rate));
+            sc_td_slow_att = std::exp(-1000.0 / (25.0 * s_rate));
+            sc_td_slow_rel = std::exp(-1000.0 / (250.0 * s_rate));
+
+            smooth_alpha = std::exp(-1.0 / (0.020 * s_rate));
+        }
+
+        // --- OVERSAMPLED RATE (prepare, and every Quality mode switch) ---
+        if (dirty & (MixBusDirty::Fixed | MixBusDirty::OsRate))
+        {
+            os_srate = s_rate * (double)os_factor;
+            smooth_alpha_os = std::exp(-1.0 / (0.020 * os_srate));
+
+            if (os_srate > 0.0) {
+                steel_dt = 1.0 / os_srate;
+                steel_dy_gain = os_srate;
+                const double leak_hz = 6.0;
+                steel_leak_coeff = std::exp(-2.0 * juce::MathConstants<double>::pi * leak_hz / os_srate);
+            }
+        }
+
+        // --- DETECTOR RATE ---
+        // Everything the detector integrates per step is designed at det_rate, so a rate change
+        // redesigns the timing, RMS window and crest groups below.
+        if (dirty & (MixBusDirty::Fixed | MixBusDirty::DetRate))
+        {
+            const int factor = (p_det_rate == 1)
+                ? juce::jlimit(1, maxDetectorDecimation, (int)std::lround(s_rate / detectorControlRate))
+                : 1;
+
+            if (factor != det_decimation)
             {
-                rms_window = clamped;
-                rms_pos = 0;
-                rms_sum_l = rms_sum_r = 0.0;
-                std::fill(rms_ring_l.begin(), rms_ring_l.begin() + (size_t)rms_window, 0.0);
-                std::fill(rms_ring_r.begin(), rms_ring_r.begin() + (size_t)rms_window, 0.0);
+                det_decimation = factor;
+                resetControlRateState();
             }
+
+            det_rate = s_rate / (double)det_decimation;
+            flux_decay = std::pow(0.995, (double)det_decimation);
+            dirty |= MixBusDirty::Timing | MixBusDirty::Rms | MixBusDirty::Crest | MixBusDirty::TpFlux;
+        }
+
+        // --- DYNAMICS ---
+        if (dirty & MixBusDirty::Timing)
+        {
+            const double attMul = (p_turbo_att ? 0.1 : 1.0);
+            const double relMul = (p_turbo_rel ? 0.1 : 1.0);
+            const double att_ms = std::max(0.05, (double)p_att_ms * attMul);
+            const double rel_ms = std::max(1.0, (double)p_rel_ms * relMul);
+
+            att_coeff = std::exp(-1000.0 / (att_ms * det_rate));
+            rel_coeff_manual = std::exp(-1000.0 / (rel_ms * det_rate));
+            auto_rel_slow = std::exp(-1000.0 / (1200.0 * det_rate));
+            auto_rel_fast = std::exp(-1000.0 / (80.0 * det_rate));
         }
 
-        stereo_link = juce::jlimit(0.0, 1.0, (double)p_stereo_link / 100.0);
-        fb_blend = juce::jlimit(0.0, 1.0, (double)p_fb_blend / 100.0);
+        if (dirty & MixBusDirty::Rms)
+        {
+            use_rms = (p_det_rms > 0.0f);
+            if (use_rms) {
+                const double win_ms = std::max(1.0, (double)p_det_rms);
+                const int desired = std::max(1, (int)std::round((win_ms * 0.001) * det_rate));
+                const int clamped = std::min(desired, rms_window_max);
+                if (clamped != rms_window)
+                {
+                    rms_window = clamped;
+                    rms_pos = 0;
+                    rms_sum_lr = rms_lap_lr = Double2::broadcast(0.0);
+                    std::fill(rms_ring.begin(), rms_ring.begin() + (size_t)rms_window * 2, 0.0f);
+                }
+            }
+        }
 
-        sc_hp_l.update_hpf((double)p_sc_hp_freq, 0.707, s_rate);
-        sc_hp_r.update_hpf((double)p_sc_hp_freq, 0.707, s_rate);
-        sc_hp_l_2.update_hpf((double)p_sc_hp_freq, 0.707, s_rate);
-        sc_hp_r_2.update_hpf((double)p_sc_hp_freq, 0.707, s_rate);
+        if (dirty & MixBusDirty::Link)
+        {
+            stereo_link = juce::jlimit(0.0, 1.0, (double)p_stereo_link / 100.0);
+            fb_blend = juce::jlimit(0.0, 1.0, (double)p_fb_blend / 100.0);
+        }
 
-        sc_lp_l.update_lpf(std::max(40.0, (double)p_sc_lp_freq), 0.707, s_rate);
-        sc_lp_r.update_lpf(std::max(40.0, (double)p_sc_lp_freq), 0.707, s_rate);
-        sc_lp_l_2.update_lpf(std::max(40.0, (double)p_sc_lp_freq), 0.707, s_rate);
-        sc_lp_r_2.update_lpf(std::max(40.0, (double)p_sc_lp_freq), 0.707, s_rate);
+        if (dirty & MixBusDirty::CompGains)
+        {
+            comp_in_target = dbToLin((double)p_comp_input);
+            makeup_lin_target = dbToLin((double)p_makeup);
+            sc_level_target = dbToLin((double)p_sc_level_db);
+            ms_bal_target = dbToLin((double)p_ms_balance_db);
+        }
 
-        thrust_gain_db = 0.0;
-        if (p_thrust_mode == 1) thrust_gain_db = 3.0;
-        if (p_thrust_mode == 2) thrust_gain_db = 6.0;
-        if (p_thrust_mode > 0) {
+        // --- SIDECHAIN CONDITIONING ---
+        if (dirty & MixBusDirty::Thrust)
+        {
+            thrust_gain_db = 0.0;
+            if (p_thrust_mode == 1) thrust_gain_db = 3.0;
+            if (p_thrust_mode == 2) thrust_gain_db = 6.0;
             sc_shelf_l.update_shelf(90.0, thrust_gain_db, 0.707, s_rate);
-            sc_shelf_r.update_shelf(90.0, thrust_gain_db, 0.707, s_rate);
+            if (p_thrust_mode == 0) {
+                // Off is the identity, which the sidechain cascade drops (see filterSidechain)
+                sc_shelf_l.makeIdentity();
+            }
+            sc_shelf_r.setCoeffs(sc_shelf_l.getCoeffs());
+            for (auto& b : sc_bed) b.shelf.setCoeffs(sc_shelf_l.getCoeffs());
+        }
+
+        if (dirty & MixBusDirty::ScTd)
+        {
+            sc_td_amt_target = juce::jlimit(-1.0, 1.0, (double)p_sc_td_amt / 100.0);
+            sc_td_ms_target = juce::jlimit(0.0, 1.0, (double)p_sc_td_ms / 100.0);
         }
 
-        crest_target_db = (double)p_crest_target;
-        crest_speed_ms = std::max(5.0, (double)p_crest_speed);
-        crest_coeff = std::exp(-1000.0 / (crest_speed_ms * s_rate));
+        // --- CONTROL LAYER ---
+        if (dirty & MixBusDirty::Crest)
+        {
+            crest_target_db = (double)p_crest_target;
+            crest_speed_ms = std::max(5.0, (double)p_crest_speed);
+            crest_coeff = std::exp(-1000.0 / (crest_speed_ms * det_rate));
+        }
+
+        if (dirty & MixBusDirty::TpFlux)
+        {
+            tp_enabled = (p_tp_mode != 0);
+            tp_amt = juce::jlimit(0.0, 1.0, (double)p_tp_amount / 100.0);
+            tp_raise_db = std::max(0.0, (double)p_tp_thresh_raise);
+
+            flux_enabled = (p_flux_mode != 0);
+            flux_amt = juce::jlimit(0.0, 1.0, (double)p_flux_amount / 100.0);
 
-        tp_enabled = (p_tp_mode != 0);
-        tp_amt = juce::jlimit(0.0, 1.0, (double)p_tp_amount / 100.0);
-        tp_raise_db = std::max(0.0, (double)p_tp_thresh_raise);
+            const double cl_hz = controlLayerRates[(size_t)juce::jlimit(0, 3, p_cl_rate)];
+            const int interval = (cl_hz > 0.0)
+                ? juce::jlimit(1, maxControlLayerInterval, (int)std::lround(det_rate / cl_hz))
+                : 1;
 
-        flux_enabled = (p_flux_mode != 0);
-        flux_amt = juce::jlimit(0.0, 1.0, (double)p_flux_amount / 100.0);
+            if (interval != cl_interval)
+            {
+                cl_interval = interval;
+                cl_inv_interval = 1.0 / (double)interval;
+                cl_phase = 0;
+                cl_tp_avg_peak = 0.0;
+                cl_flux_peak = 0.0;
+            }
+            cl_flux_decay = std::pow(flux_decay, (double)cl_interval);
+        }
 
-        comp_in_target = dbToLin((double)p_comp_input);
-        makeup_lin_target = dbToLin((double)p_makeup);
-        sc_level_target = dbToLin((double)p_sc_level_db);
-        ms_bal_target = dbToLin((double)p_ms_balance_db);
+        // --- AUTOMATABLE CURVES (SC filters, tone, girth, harmonic emphasis) ---
+        // With a worker attached these are only posted here; finished sets come back through
+        // the design stage and are ramped in below. prepare() always designs in place so the
+        // first chunk never runs on undesigned coefficients.
+        if (dirty & MixBusDirty::Designed)
+        {
+            const auto request = makeDesignRequest();
 
-        // Sidechain transient designer
-        sc_td_amt_target = juce::jlimit(-1.0, 1.0, (double)p_sc_td_amt / 100.0);
-        sc_td_ms_target = juce::jlimit(0.0, 1.0, (double)p_sc_td_ms / 100.0);
-        sc_td_fast_att = std::exp(-1000.0 / (1.0 * s_rate));
-        sc_td_fast_rel = std::exp(-1000.0 / (30.0 * s_rate));
-        sc_td_slow_att = std::exp(-1000.0 / (25.0 * s_rate));
-        sc_td_slow_rel = std::exp(-1000.0 / (250.0 * s_rate));
+            if (async_filter_design.load(std::memory_order_relaxed) && (dirty & (MixBusDirty::Fixed | MixBusDirty::OsRate)) == 0)
+            {
+                filter_design.post(request);
+            }
+            else
+            {
+                // A ramp in flight leaves designed_now part-way, so finish every slot in that case.
+                const std::uint32_t slots = designed_ramping ? FilterDesignStage::allSlots : designSlotsFor(dirty);
+                FilterDesignStage::design(request, designed_now, slots);
+                designed_target = designed_now;
+                designed_ramping = false;
+                design_min_serial = request.serial;
+                applyDesignedCoefficients();
+            }
+        }
 
-        smooth_alpha = std::exp(-1.0 / (0.020 * s_rate));
-        os_srate = s_rate * (double)os_factor;
-        smooth_alpha_os = std::exp(-1.0 / (0.020 * os_srate));
+        updateDesignedCoefficients();
 
-        sat_tone_l.update_shelf((double)p_sat_tone_freq, (double)p_sat_tone, 0.707, s_rate);
-        sat_tone_r.update_shelf((double)p_sat_tone_freq, (double)p_sat_tone, 0.707, s_rate);
+        if (dirty & MixBusDirty::SatGains)
+        {
+            sat_pre_lin_target = dbToLin((double)p_sat_pre_gain);
+            sat_drive_lin_target = dbToLin((double)p_sat_drive);
+            sat_mix_target = juce::jlimit(0.0, 1.0, (double)p_sat_mix / 100.0);
+            sat_trim_lin = dbToLin((double)p_sat_trim);
+        }
 
-        // --- PULTEC-STYLE LOW-END TRICK (TUNED) ---
+        // --- OUTPUT ---
+        if (dirty & MixBusDirty::Output)
         {
-            const int idx = juce::jlimit(0, 3, p_girth_freq_sel);
-            static const double freqs[4] = { 20.0, 30.0, 60.0, 100.0 };
-            static const double dips[4] = { 65.0, 97.5, 195.0, 325.0 };
-
-            const double f0 = freqs[idx];
-            const double fd = dips[idx];
-
-            const double bumpQ = 1.0;
-            const double dipQ = 0.6;
-
-            const double bumpDb = (double)p_girth;
-            const double dipDb = -(double)p_girth * 0.80;
-            girth_bump_l.update_low_shelf(f0 * 4.0, bumpDb, bumpQ, s_rate);
-            girth_bump_r.update_low_shelf(f0 * 4.0, bumpDb, bumpQ, s_rate);
-            girth_dip_l.update_peak(fd, dipDb, dipQ, s_rate);
-            girth_dip_r.update_peak(fd, dipDb, dipQ, s_rate);
-        }
-
-        const double hb = (double)p_harm_bright;
-        harm_pre_l.update_shelf((double)p_harm_freq, -hb, 0.707, os_srate);
-        harm_pre_r.update_shelf((double)p_harm_freq, -hb, 0.707, os_srate);
-        harm_post_l.update_shelf((double)p_harm_freq, hb, 0.707, os_srate);
-        harm_post_r.update_shelf((double)p_harm_freq, hb, 0.707, os_srate);
-
-        iron_voicing_l.update_shelf(100.0, 1.0, 0.707, s_rate);
-        iron_voicing_r.update_shelf(100.0, 1.0, 0.707, s_rate);
-        steel_low_l.update_shelf(40.0, 1.5, 0.707, s_rate);
-        steel_low_r.update_shelf(40.0, 1.5, 0.707, s_rate);
-        steel_high_l.update_lpf(9000.0, 0.707, s_rate);
-        steel_high_r.update_lpf(9000.0, 0.707, s_rate);
-
-        // MOJO PARAMETERS (Fixed "Analog" Curve)
-        mojo_hp_l.update_hpf(20.0, 0.707, s_rate);
-        mojo_hp_r.update_hpf(20.0, 0.707, s_rate);
-        mojo_low_shelf_l.update_low_shelf(80.0, 2.0, 0.9, s_rate); // Thick
-        mojo_low_shelf_r.update_low_shelf(80.0, 2.0, 0.9, s_rate);
-        mojo_dip_l.update_peak(320.0, -1.5, 1.5, s_rate); // Mud cut
-        mojo_dip_r.update_peak(320.0, -1.5, 1.5, s_rate);
-        mojo_hi_shelf_l.update_shelf(8000.0, 1.5, 0.707, s_rate); // Air
-        mojo_hi_shelf_r.update_shelf(8000.0, 1.5, 0.707, s_rate);
-        mojo_lp_l.update_lpf(18000.0, 0.707, s_rate); // Smooth top
-        mojo_lp_r.update_lpf(18000.0, 0.707, s_rate);
-
-                // MOJO: reset its internal state on rising edge to avoid stale envelope/filter history
+            in_gain_lin = std::pow(10.0f, p_in_gain * (1.0f / 20.0f));
+            out_lin_target = dbToLin((double)p_out_trim);
+            mojo_level_target = dbToLin((double)p_mojo_balance);
+            global_in_target = dbToLin((double)p_global_in);
+            global_out_target = dbToLin((double)p_global_out);
+        }
+
+        // --- PER-CHUNK STATE (no coefficient design) ---
+        // MOJO: reset its internal state on rising edge to avoid stale envelope/filter history
         if (p_mojo && !mojo_prev_on) {
-            mojo_hp_l.reset(); mojo_hp_r.reset();
-            mojo_low_shelf_l.reset(); mojo_low_shelf_r.reset();
-            mojo_dip_l.reset(); mojo_dip_r.reset();
-            mojo_hi_shelf_l.reset(); mojo_hi_shelf_r.reset();
-            mojo_lp_l.reset(); mojo_lp_r.reset();
+            mojo_hp_l.resetState(); mojo_hp_r.resetState();
+            mojo_low_shelf_l.resetState(); mojo_low_shelf_r.resetState();
+            mojo_dip_l.resetState(); mojo_dip_r.resetState();
+            mojo_hi_shelf_l.resetState(); mojo_hi_shelf_r.resetState();
+            mojo_lp_l.resetState(); mojo_lp_r.resetState();
 
             mojo_env = 0.0;
             mojo_scale_sm = 0.0;
@@ -639,28 +1027,12 @@ public:
         }
         mojo_prev_on = p_mojo;
 
-const double mojo_target = p_mojo ? 1.0 : 0.0;
+        const double mojo_target = p_mojo ? 1.0 : 0.0;
         mojo_on_sm = smooth1p(mojo_on_sm, mojo_target, smooth_alpha_block);
         mojo_mix_target = juce::jlimit(0.0, 1.0, (double)p_mojo_mix / 100.0);
 
-        if (os_srate > 0.0) {
-            steel_dt = 1.0 / os_srate;
-            steel_dy_gain = os_srate;
-            const double leak_hz = 6.0;
-            steel_leak_coeff = std::exp(-2.0 * juce::MathConstants<double>::pi * leak_hz / os_srate);
-        }
-
-        sat_pre_lin_target = dbToLin((double)p_sat_pre_gain);
-        sat_drive_lin_target = dbToLin((double)p_sat_drive);
-        sat_mix_target = juce::jlimit(0.0, 1.0, (double)p_sat_mix / 100.0);
-        sat_trim_lin = dbToLin((double)p_sat_trim);
-
-        global_in_target = dbToLin((double)p_global_in);
-        global_out_target = dbToLin((double)p_global_out);
-
         if (p_sat_mode != last_sat_mode) {
-            steel_phi_l = steel_phi_r = 0.0;
-            steel_prev_x_l = steel_prev_x_r = 0.0;
+            for (auto& c : sat_ch) c.steel_phi = c.steel_prev_x = 0.0;
             sat_agc_gain_sm = 1.0;
             last_sat_mode = p_sat_mode;
         }
@@ -672,50 +1044,241 @@ const double mojo_target = p_mojo ? 1.0 : 0.0;
     }
 
 private:
-    static inline double dbToLin(double db) { return std::pow(10.0, db / 20.0); }
-    static inline double linToDb(double lin) { return 20.0 * std::log10(std::max(lin, 1.0e-20)); }
+    // dB conversions for the detector / gain paths (accuracy contract in FastMath.h).
+    static constexpr MixBusMath::Accuracy mathAccuracy = MixBusMath::Accuracy::High;
+    static inline double dbToLin(double db) { return MixBusMath::dbToLin<mathAccuracy>(db); }
+    static inline double linToDb(double lin) { return MixBusMath::linToDb<mathAccuracy>(lin); }
+
+    // Stereo detector state is kept as L/R pairs and updated two lanes at a time.
+    using Double2 = MixBusSimd::Double2;
     static inline double smooth1p(double current, double target, double alpha) { return current + (target - current) * (1.0 - alpha); }
 
-    inline double scTdProcessSample(double x, double& fastEnv, double& slowEnv, double amt) noexcept
+    std::uint32_t dirty_groups = MixBusDirty::All;
+    ParameterSnapshot last_snapshot = MixBusParams::makeDefaultSnapshot();
+
+    // ==============================================================================
+    // DESIGNED COEFFICIENTS (see FilterDesignStage.h)
+    // ==============================================================================
+    FilterDesignStage::Request makeDesignRequest() noexcept
     {
-        const double ax = std::abs(x);
+        FilterDesignStage::Request r;
+        r.sampleRate = s_rate;
+        r.osSampleRate = os_srate;
+        r.sc_hp_freq = p_sc_hp_freq;
+        r.sc_lp_freq = p_sc_lp_freq;
+        r.sat_tone = p_sat_tone;
+        r.sat_tone_freq = p_sat_tone_freq;
+        r.girth = p_girth;
+        r.girth_freq_sel = p_girth_freq_sel;
+        r.harm_bright = p_harm_bright;
+        r.harm_freq = p_harm_freq;
+        r.serial = ++design_serial;
+        return r;
+    }
 
-        const double cFast = (ax > fastEnv) ? sc_td_fast_att : sc_td_fast_rel;
-        fastEnv = fastEnv * cFast + ax * (1.0 - cFast);
+    static std::uint32_t designSlotsFor(std::uint32_t dirty) noexcept
+    {
+        using S = FilterDesignStage;
+        std::uint32_t slots = 0;
+        if (dirty & MixBusDirty::ScHpf)   slots |= S::slotBit(S::ScHp);
+        if (dirty & MixBusDirty::ScLpf)   slots |= S::slotBit(S::ScLp);
+        if (dirty & MixBusDirty::SatTone) slots |= S::slotBit(S::SatTone);
+        if (dirty & MixBusDirty::Girth)   slots |= S::slotBit(S::GirthBump) | S::slotBit(S::GirthDip);
+        if (dirty & MixBusDirty::Harm)    slots |= S::slotBit(S::HarmPre) | S::slotBit(S::HarmPost);
+        return slots;
+    }
 
-        const double cSlow = (ax > slowEnv) ? sc_td_slow_att : sc_td_slow_rel;
-        slowEnv = slowEnv * cSlow + ax * (1.0 - cSlow);
+    void applyDesignedCoefficients() noexcept
+    {
+        using S = FilterDesignStage;
+        const auto& c = designed_now.c;
 
-        const double eps = 1.0e-12;
-        double ratio = (fastEnv + eps) / (slowEnv + eps);
-        ratio = juce::jlimit(0.25, 4.0, ratio);
+        sc_hp_l.setCoeffs(c[S::ScHp]); sc_hp_r.setCoeffs(c[S::ScHp]);
+        sc_hp_l_2.setCoeffs(c[S::ScHp]); sc_hp_r_2.setCoeffs(c[S::ScHp]);
+        sc_lp_l.setCoeffs(c[S::ScLp]); sc_lp_r.setCoeffs(c[S::ScLp]);
+        sc_lp_l_2.setCoeffs(c[S::ScLp]); sc_lp_r_2.setCoeffs(c[S::ScLp]);
 
-        // amt is -1..1, depth scales aggression (detector-only, so we can be reasonably assertive)
-        const double depth = 2.0;
-        double g = std::exp(std::log(ratio) * (amt * depth));
-        g = juce::jlimit(0.25, 4.0, g);
+        for (auto& b : sc_bed) {
+            b.hp.setCoeffs(c[S::ScHp]); b.hp_2.setCoeffs(c[S::ScHp]);
+            b.lp.setCoeffs(c[S::ScLp]); b.lp_2.setCoeffs(c[S::ScLp]);
+        }
 
-        return x * g;
+        for (auto& ch : sat_ch) {
+            ch.tone.setCoeffs(c[S::SatTone]);
+            ch.girth_bump.setCoeffs(c[S::GirthBump]);
+            ch.girth_dip.setCoeffs(c[S::GirthDip]);
+            ch.harm_pre.setCoeffs(c[S::HarmPre]);
+            ch.harm_post.setCoeffs(c[S::HarmPost]);
+        }
     }
 
-    inline void applySidechainTransientDesigner(double& s_l, double& s_r) noexcept
+    // Picks up the newest worker result and moves the live coefficients toward it once per chunk,
+    // on the same 20 ms one-pole as the other block-rate controls. Any mix of two stable biquads'
+    // (a1, a2) stays inside the stability triangle, so the intermediate filters are stable too.
+    void updateDesignedCoefficients() noexcept
     {
-        const double amt = juce::jlimit(-1.0, 1.0, sc_td_amt_sm);
-        if (std::abs(amt) < 1.0e-9)
+        if (const auto* fresh = filter_design.poll())
+        {
+            // Results designed before the last in-place design (e.g. at the old sample rate) are stale.
+            if (fresh->serial > design_min_serial)
+            {
+                designed_target = *fresh;
+                designed_ramping = true;
+            }
+        }
+
+        if (!designed_ramping)
             return;
 
-        const double blend = juce::jlimit(0.0, 1.0, sc_td_ms_sm);
-        const double amtMid = amt * (1.0 - blend);
-        const double amtSide = amt * blend;
+        double maxDelta = 0.0;
+        for (int i = 0; i < FilterDesignStage::NumSlots; ++i)
+        {
+            auto& now = designed_now.c[i];
+            const auto& to = designed_target.c[i];
+            double* n[5] = { &now.b0, &now.b1, &now.b2, &now.a1, &now.a2 };
+            const double t[5] = { to.b0, to.b1, to.b2, to.a1, to.a2 };
+
+            for (int k = 0; k < 5; ++k)
+            {
+                *n[k] = smooth1p(*n[k], t[k], smooth_alpha_block);
+                maxDelta = std::max(maxDelta, std::abs(t[k] - *n[k]));
+            }
+        }
+
+        if (maxDelta < 1.0e-9)
+        {
+            designed_now = designed_target;
+            designed_ramping = false;
+        }
+
+        applyDesignedCoefficients();
+    }
+
+    void applyFixedVoicingCurves(const FixedVoicingCurves& f) noexcept
+    {
+        using F = FixedVoicingCurves;
+        for (auto& ch : sat_ch) {
+            ch.iron_voicing.setCoeffs(f.c[F::IronVoicing]);
+            ch.steel_low.setCoeffs(f.c[F::SteelLow]);
+            ch.steel_high.setCoeffs(f.c[F::SteelHigh]);
+        }
+        mojo_hp_l.setCoeffs(f.c[F::MojoHp]); mojo_hp_r.setCoeffs(f.c[F::MojoHp]);
+        mojo_low_shelf_l.setCoeffs(f.c[F::MojoLowShelf]); mojo_low_shelf_r.setCoeffs(f.c[F::MojoLowShelf]);
+        mojo_dip_l.setCoeffs(f.c[F::MojoDip]); mojo_dip_r.setCoeffs(f.c[F::MojoDip]);
+        mojo_hi_shelf_l.setCoeffs(f.c[F::MojoHiShelf]); mojo_hi_shelf_r.setCoeffs(f.c[F::MojoHiShelf]);
+        mojo_lp_l.setCoeffs(f.c[F::MojoLp]); mojo_lp_r.setCoeffs(f.c[F::MojoLp]);
+    }
+
+    juce::SharedResourcePointer<FixedVoicingCurveStore> fixed_curve_store;
+
+    // ==============================================================================
+    // COMPRESSOR CONTROL SMOOTHING (see BlockRamp.h)
+    // ==============================================================================
+    enum CompSmoothed { SmThresh = 0, SmRatio, SmKnee, SmCompIn, SmMakeup, SmScLevel, SmTdAmt, SmTdMs, SmMsBal, NumCompSmoothed };
+    using CompRampBank = BlockRampBank<NumCompSmoothed>;
+
+    std::array<double*, NumCompSmoothed> compSmoothedValues() noexcept
+    {
+        return { &thresh_sm, &ratio_sm, &knee_sm, &comp_in_sm, &makeup_lin_sm,
+                 &sc_level_sm, &sc_td_amt_sm, &sc_td_ms_sm, &ms_bal_sm };
+    }
+
+    bool beginCompRamps(std::uint32_t which, int nSamp, double* const* values) noexcept
+    {
+        const double targets[NumCompSmoothed] = {
+            (double)p_thresh, std::max(1.0, (double)p_ratio), std::max(0.0, (double)p_knee),
+            comp_in_target, makeup_lin_target, sc_level_target,
+            sc_td_amt_target, sc_td_ms_target, ms_bal_target
+        };
+        return comp_ramps.begin(values, targets, which, nSamp) != 0;
+    }
+
+    CompRampBank comp_ramps;
+
+    // Static gain curve tabulated against detector level (see GainComputer.h).
+    GainComputerTable<64> gain_table;
+
+    FilterDesignStage filter_design;
+    std::atomic<bool> async_filter_design{ false };
+
+    // Offline render profile (see RENDER PROFILE)
+    std::atomic<bool> offline_render{ false };
+    bool render_armed = false; // the last prepare() ran offline
+    bool render_upgrade = false;
+    FilterDesignStage::CoefficientSet designed_now, designed_target;
+    bool designed_ramping = false;
+    std::uint32_t design_serial = 0, design_min_serial = 0;
+
+    // ==============================================================================
+    // SIDECHAIN TRANSIENT DESIGNER
+    // Mid in lane 0, side in lane 1. Each band runs a fast and a slow envelope follower and is
+    // scaled by (fast / slow)^(2 * amt), ratio and gain both clamped to 0.25..4.
+    // - The power is exp(4 * amt * atanh(t)) with t = (fast - slow) / (fast + slow); the ratio
+    //   clamp is |t| <= 0.6, where a fitted polynomial stands in for atanh (< 1.2e-6 abs error)
+    //   and the exponential is the 2-lane Fast exp2: < 1e-4 dB of gain overall
+    // - A band whose amount is 0 gets exactly unity gain and costs nothing extra in its lane
+    // - Samples with no amount at all leave the envelopes untouched
+    // ==============================================================================
+    template <MixBusMath::Accuracy A>
+    static Double2 scTdAtanh(Double2 t) noexcept
+    {
+        if constexpr (A == MixBusMath::Accuracy::Exact)
+            return Double2::set(std::atanh(t.lane0()), std::atanh(t.lane1()));
+
+        const Double2 u = t * t;
+        return t * (1.000016935094832 + u * (0.3324295011743796 + u * (0.21325666373925117
+                    + u * (0.06637305714063425 + u * 0.28679720998950914))));
+    }
+
+    template <MixBusMath::Accuracy A>
+    void processSidechainTransientDesigner(double* det_l, double* det_r,
+                                           const double* amt_ramp, const double* ms_ramp, int n) noexcept
+    {
+        constexpr double depth = 2.0; // amt is -1..1; detector-only, so reasonably assertive
+        constexpr double eps = 1.0e-12;
+        constexpr double log2e = 1.44269504088896340736;
+        const double ln4 = std::log(4.0);
+
+        Double2 fast = Double2::set(sc_td_fast_mid, sc_td_fast_side);
+        Double2 slow = Double2::set(sc_td_slow_mid, sc_td_slow_side);
+
+        const Double2 fast_att = Double2::broadcast(sc_td_fast_att), fast_att_in = Double2::broadcast(1.0 - sc_td_fast_att);
+        const Double2 fast_rel = Double2::broadcast(sc_td_fast_rel), fast_rel_in = Double2::broadcast(1.0 - sc_td_fast_rel);
+        const Double2 slow_att = Double2::broadcast(sc_td_slow_att), slow_att_in = Double2::broadcast(1.0 - sc_td_slow_att);
+        const Double2 slow_rel = Double2::broadcast(sc_td_slow_rel), slow_rel_in = Double2::broadcast(1.0 - sc_td_slow_rel);
+        const Double2 t_max = Double2::broadcast(0.6), t_min = Double2::broadcast(-0.6);
+        const Double2 y_max = Double2::broadcast(ln4), y_min = Double2::broadcast(-ln4);
+
+        for (int i = 0; i < n; ++i)
+        {
+            const double amt = juce::jlimit(-1.0, 1.0, amt_ramp ? amt_ramp[i] : sc_td_amt_sm);
+            if (std::abs(amt) < 1.0e-9)
+                continue;
+
+            const double blend = juce::jlimit(0.0, 1.0, ms_ramp ? ms_ramp[i] : sc_td_ms_sm);
+            const Double2 amt_ms = Double2::set(amt * (1.0 - blend), amt * blend);
 
-        const double mid = (s_l + s_r) * 0.5;
-        const double side = (s_l - s_r) * 0.5;
+            const Double2 x = Double2::set((det_l[i] + det_r[i]) * 0.5, (det_l[i] - det_r[i]) * 0.5);
+            const Double2 ax = Double2::abs(x);
 
-        const double midP = scTdProcessSample(mid, sc_td_fast_mid, sc_td_slow_mid, amtMid);
-        const double sideP = scTdProcessSample(side, sc_td_fast_side, sc_td_slow_side, amtSide);
+            const Double2 rising_fast = Double2::lessThan(fast, ax);
+            fast = fast * Double2::select(rising_fast, fast_att, fast_rel) + ax * Double2::select(rising_fast, fast_att_in, fast_rel_in);
 
-        s_l = midP + sideP;
-        s_r = midP - sideP;
+            const Double2 rising_slow = Double2::lessThan(slow, ax);
+            slow = slow * Double2::select(rising_slow, slow_att, slow_rel) + ax * Double2::select(rising_slow, slow_att_in, slow_rel_in);
+
+            const Double2 fe = fast + eps;
+            const Double2 se = slow + eps;
+            const Double2 t = Double2::min(Double2::max((fe - se) / (fe + se), t_min), t_max);
+            const Double2 y = Double2::min(Double2::max((2.0 * depth) * amt_ms * scTdAtanh<A>(t), y_min), y_max);
+            const Double2 p = x * MixBusSimd::exp2<A>(y * log2e);
+
+            det_l[i] = p.lane0() + p.lane1();
+            det_r[i] = p.lane0() - p.lane1();
+        }
+
+        sc_td_fast_mid = fast.lane0(); sc_td_fast_side = fast.lane1();
+        sc_td_slow_mid = slow.lane0(); sc_td_slow_side = slow.lane1();
     }
 
     // Resets detector-conditioning states (sidechain biquads + TD envelopes).
@@ -728,6 +1291,7 @@ private:
         sc_lp_l.resetState();   sc_lp_r.resetState();
         sc_lp_l_2.resetState(); sc_lp_r_2.resetState();
         sc_shelf_l.resetState(); sc_shelf_r.resetState();
+        for (auto& c : sc_bed) { c.hp.resetState(); c.hp_2.resetState(); c.lp.resetState(); c.lp_2.resetState(); c.shelf.resetState(); }
 
         sc_td_fast_mid = sc_td_slow_mid = 0.0;
         sc_td_fast_side = sc_td_slow_side = 0.0;
@@ -850,159 +1414,617 @@ private:
         }
     }
 
-    void processCompressorBlock(juce::AudioBuffer<float>& io)
-    {
-        const int nSamp = io.getNumSamples();
-        float* l = io.getWritePointer(0);
-        float* r = io.getWritePointer(1);
-        float* sc_l = sc_internal_buf.getWritePointer(0);
-        float* sc_r = sc_internal_buf.getWritePointer(1);
-
-        // TRUE BYPASS: If the Dynamics module is bypassed, do not touch the program signal.
-        // This guarantees null/bit-transparent behavior for "all modules bypassed" scenarios.
-        if (!p_active_dyn)
-        {
-            det_env = 0.0; env = 0.0;
-            env_l = env_r = 0.0;
-            env_fast = env_slow = 0.0;
-            env_fast_l = env_fast_r = 0.0;
-            env_slow_l = env_slow_r = 0.0;
-            fb_prev_l = fb_prev_r = 0.0;
-            return;
-        }
+    // ==============================================================================
+    // SIDECHAIN CONDITIONING STAGE
+    // Builds the detector feed for a whole block ahead of the serial envelope loop:
+    // source and trims, HPF x2, LPF x2, Thrust shelf, transient designer, then the M/S
+    // detector selection. The L/R filter pairs run two lanes at a time (MixBusSimd::biquadCascade).
+    // The SC audition monitors this same feed.
+    //   Program        the program itself (Key -> Comp off)
+    //   Key            the key, trimmed only (detector section bypassed)
+    //   KeyConditioned the key through the full conditioning chain
+    // ==============================================================================
+    enum class ScPath { Program = 0, Key, KeyConditioned };
 
-        const double thresh_target = (double)p_thresh;
-        const double ratio_target = std::max(1.0, (double)p_ratio);
-        const double knee_target = std::max(0.0, (double)p_knee);
+    ScPath sidechainPath() const noexcept
+    {
+        return !p_sc_to_comp ? ScPath::Program : (p_active_det ? ScPath::KeyConditioned : ScPath::Key);
+    }
 
-        // Auto-Gain Measurement Accumulators
-        double sum_in_rms = 0.0;
-        double sum_out_rms = 0.0;
+    // Writes n samples to sc_det_l / sc_det_r. Reads the comp ramps begun for this block.
+    void conditionSidechain(const float* prog_l, const float* prog_r, ScPath path, bool perChannel, int n) noexcept
+    {
+        double* det_l = sc_det_l.data();
+        double* det_r = sc_det_r.data();
 
-        for (int i = 0; i < nSamp; ++i)
+        if (path == ScPath::Program)
         {
-            thresh_sm = smooth1p(thresh_sm, thresh_target, smooth_alpha);
-            ratio_sm = smooth1p(ratio_sm, ratio_target, smooth_alpha);
-            knee_sm = smooth1p(knee_sm, knee_target, smooth_alpha);
-
-            comp_in_sm = smooth1p(comp_in_sm, comp_in_target, smooth_alpha);
-            makeup_lin_sm = smooth1p(makeup_lin_sm, makeup_lin_target, smooth_alpha);
-            sc_level_sm = smooth1p(sc_level_sm, sc_level_target, smooth_alpha);
-            sc_td_amt_sm = smooth1p(sc_td_amt_sm, sc_td_amt_target, smooth_alpha);
-            sc_td_ms_sm = smooth1p(sc_td_ms_sm, sc_td_ms_target, smooth_alpha);
-            ms_bal_sm = smooth1p(ms_bal_sm, ms_bal_target, smooth_alpha);
-            // 1. Apply Input Gain (Drive)
-            double in_gain = comp_in_sm;
-            l[i] *= (float)in_gain;
-            r[i] *= (float)in_gain;
-
-            // RMS Input Measurement (Post-Input Gain, Pre-GR)
-            if (p_comp_autogain_mode > 0) {
-                sum_in_rms += (double)l[i] * (double)l[i] + (double)r[i] * (double)r[i];
+            for (int i = 0; i < n; ++i) {
+                det_l[i] = (double)prog_l[i];
+                det_r[i] = (double)prog_r[i];
             }
+        }
+        else
+        {
+            const float* key_l = sc_internal_buf.getReadPointer(0);
+            const float* key_r = sc_internal_buf.getReadPointer(1);
 
-            // --- 2. SIDECHAIN CONDITIONING ---
-            double s_l = (double)sc_l[i];
-            double s_r = (double)sc_r[i];
+            // Internal SC follows the compressor's input trim, so the key tracks the program it came from.
+            const double* in_ramp = comp_ramps.ramp(SmCompIn);
+            const double* level_ramp = comp_ramps.ramp(SmScLevel);
+            const bool sc_internal = (p_sc_input_mode == 0);
 
-            if (p_sc_input_mode == 0) {
-                s_l *= in_gain;
-                s_r *= in_gain;
-            }
+            // Settled trims snap to their targets, so unity is exactly 1.0
+            const bool unity_trims = level_ramp == nullptr && sc_level_sm == 1.0
+                                  && (!sc_internal || (in_ramp == nullptr && comp_in_sm == 1.0));
 
-            if (!p_sc_to_comp) {
-                s_l = (double)l[i];
-                s_r = (double)r[i];
+            if (unity_trims)
+            {
+                for (int i = 0; i < n; ++i) {
+                    det_l[i] = (double)key_l[i];
+                    det_r[i] = (double)key_r[i];
+                }
             }
-            else {
-                s_l *= sc_level_sm;
-                s_r *= sc_level_sm;
-
-                if (p_active_det) {
-                    s_l = sc_hp_l_2.process(sc_hp_l.process(s_l));
-                    s_r = sc_hp_r_2.process(sc_hp_r.process(s_r));
-                    s_l = sc_lp_l_2.process(sc_lp_l.process(s_l));
-                    s_r = sc_lp_r_2.process(sc_lp_r.process(s_r));
-                    if (p_thrust_mode > 0) {
-                        s_l = sc_shelf_l.process(s_l);
-                        s_r = sc_shelf_r.process(s_r);
+            else
+            {
+                for (int i = 0; i < n; ++i) {
+                    double s_l = (double)key_l[i];
+                    double s_r = (double)key_r[i];
+
+                    if (sc_internal) {
+                        const double in_gain = in_ramp ? in_ramp[i] : comp_in_sm;
+                        s_l *= in_gain;
+                        s_r *= in_gain;
                     }
+
+                    const double level = level_ramp ? level_ramp[i] : sc_level_sm;
+                    det_l[i] = s_l * level;
+                    det_r[i] = s_r * level;
                 }
             }
 
-            // Sidechain transient designer (post filters)
-            // Only meaningful when the sidechain is actually driving the detector and detector tools are enabled.
-            if (p_sc_to_comp && p_active_det)
-                applySidechainTransientDesigner(s_l, s_r);
+            if (path == ScPath::KeyConditioned)
+            {
+                filterSidechain(det_l, det_r, n);
 
-            // --- 3. DETECTOR ---
-            double det_in_l = s_l;
-            double det_in_r = s_r;
-
-            if (p_ms_mode > 0) {
-                double mid = (s_l + s_r) * 0.5;
-                double side = (s_l - s_r) * 0.5;
-                if (p_ms_mode == 1) { det_in_l = mid; det_in_r = mid; }
-                else if (p_ms_mode == 2) { det_in_l = side; det_in_r = side; }
-                else if (p_ms_mode == 3) { det_in_l = mid; det_in_r = mid; }
-                else if (p_ms_mode == 4) { det_in_l = side; det_in_r = side; }
+                // Sidechain transient designer (post filters); skipped at zero amount
+                const double* amt_ramp = comp_ramps.ramp(SmTdAmt);
+                const double* ms_ramp = comp_ramps.ramp(SmTdMs);
+                if (amt_ramp != nullptr || std::abs(sc_td_amt_sm) >= 1.0e-9)
+                {
+                    if (render_upgrade)
+                        processSidechainTransientDesigner<MixBusMath::Accuracy::Exact>(det_l, det_r, amt_ramp, ms_ramp, n);
+                    else
+                        processSidechainTransientDesigner<MixBusMath::Accuracy::Fast>(det_l, det_r, amt_ramp, ms_ramp, n);
+                }
             }
-            // FIXED: Feedback uses fb_prev stored BEFORE makeup gain
-            det_in_l = det_in_l * (1.0 - fb_blend) + fb_prev_l * fb_blend;
-            det_in_r = det_in_r * (1.0 - fb_blend) + fb_prev_r * fb_blend;
-            runDetector(det_in_l, det_in_r);
-
-            // --- 4. APPLY GAIN REDUCTION ---
-            const double lin_gain_l = std::pow(10.0, env_l / 20.0);
-            const double lin_gain_r = std::pow(10.0, env_r / 20.0);
-            const double lin_gain_mono = std::pow(10.0, env / 20.0);
-
-            // Apply GR first (Pre-Makeup)
-            double pre_make_l = 0.0;
-            double pre_make_r = 0.0;
-
-            double in_l = (double)l[i];
-            double in_r = (double)r[i];
+        }
 
-            if (p_ms_mode == 0) {
-                pre_make_l = in_l * lin_gain_l;
-                pre_make_r = in_r * lin_gain_r;
+        // M/S modes are single-detector: Mid for Mid / M>S, Side for Side / S>M
+        if (!perChannel)
+        {
+            const bool mid = (p_ms_mode == 1 || p_ms_mode == 3);
+            for (int i = 0; i < n; ++i) {
+                const double det_ms = mid ? (det_l[i] + det_r[i]) * 0.5 : (det_l[i] - det_r[i]) * 0.5;
+                det_l[i] = det_ms;
+                det_r[i] = det_ms;
             }
-            else {
-                double mid = (in_l + in_r) * 0.5;
-                double side = (in_l - in_r) * 0.5;
-                if (p_ms_mode == 1) mid *= lin_gain_mono;
-                else if (p_ms_mode == 2) side *= lin_gain_mono;
-                else if (p_ms_mode == 3) side *= lin_gain_mono;
-                else if (p_ms_mode == 4) mid *= lin_gain_mono;
+        }
+    }
 
-                // NEW: M/S balance tilt for cross-modes (keeps energy roughly consistent)
-                if (p_ms_mode == 3) { mid *= (1.0 / ms_bal_sm); side *= ms_bal_sm; }
-                else if (p_ms_mode == 4) { mid *= ms_bal_sm; side *= (1.0 / ms_bal_sm); }
-                pre_make_l = mid + side;
-                pre_make_r = mid - side;
-            }
+    // HPF x2, LPF x2, then the Thrust shelf. Stages at their identity design (HPF fully down,
+    // Thrust off) are left out of the cascade and primed afterwards from the signal history,
+    // so turning one back on picks up without a step.
+    void filterSidechain(double* det_l, double* det_r, int n) noexcept
+    {
+        SimpleBiquad* const chain_l[] = { &sc_hp_l, &sc_hp_l_2, &sc_lp_l, &sc_lp_l_2, &sc_shelf_l };
+        SimpleBiquad* const chain_r[] = { &sc_hp_r, &sc_hp_r_2, &sc_lp_r, &sc_lp_r_2, &sc_shelf_r };
+        filterSidechainLanes(chain_l, chain_r, det_l, det_r, n);
+    }
 
-            // Store Feedback Tap (Pre-Makeup)
-            fb_prev_l = pre_make_l;
-            fb_prev_r = pre_make_r;
+    // One 2-lane pass of the conditioning cascade; the two chains must share a design.
+    static void filterSidechainLanes(SimpleBiquad* const* chain_l, SimpleBiquad* const* chain_r,
+                                     double* det_l, double* det_r, int n) noexcept
+    {
+        constexpr int numStages = 5;
 
-            // RMS Output Measurement (Pre-Makeup)
-            if (p_comp_autogain_mode > 0) {
-                sum_out_rms += pre_make_l * pre_make_l + pre_make_r * pre_make_r;
+        // Both lanes share a design, so the left filter speaks for the pair.
+        SimpleBiquad* live_l[numStages];
+        SimpleBiquad* live_r[numStages];
+        int live = 0;
+        for (int k = 0; k < numStages; ++k)
+        {
+            if (!chain_l[k]->isIdentity())
+            {
+                live_l[live] = chain_l[k];
+                live_r[live] = chain_r[k];
+                ++live;
             }
+        }
 
-            // 5. Apply Makeup & Auto-Gain
-            const double final_agc = (double)comp_agc_gain_sm;
-            const double mirror = 1.0; // UI mirror handles comp I/O linking; no additional DSP mirroring.
-            l[i] = (float)(pre_make_l * makeup_lin_sm * final_agc * mirror);
-            r[i] = (float)(pre_make_r * makeup_lin_sm * final_agc * mirror);
+        switch (live)
+        {
+            case 1: MixBusSimd::biquadCascade<1>(live_l, live_r, det_l, det_r, n); break;
+            case 2: MixBusSimd::biquadCascade<2>(live_l, live_r, det_l, det_r, n); break;
+            case 3: MixBusSimd::biquadCascade<3>(live_l, live_r, det_l, det_r, n); break;
+            case 4: MixBusSimd::biquadCascade<4>(live_l, live_r, det_l, det_r, n); break;
+            case 5: MixBusSimd::biquadCascade<5>(live_l, live_r, det_l, det_r, n); break;
+            default: break;
         }
 
-        // --- COMPRESSOR AUTO-GAIN LOGIC (Block Level) ---
-        if (p_comp_autogain_mode > 0 && sum_in_rms > 1e-12) {
-            double rms_in = std::sqrt(sum_in_rms / (double)(nSamp * 2));
-            double rms_out = std::sqrt(sum_out_rms / (double)(nSamp * 2)); // This is Post-GR, Pre-Makeup
+        if (live < numStages && n > 0)
+        {
+            SimpleBiquad::primeElidedStages(chain_l, numStages, det_l[n - 1], n > 1 ? det_l[n - 2] : 0.0, n);
+            SimpleBiquad::primeElidedStages(chain_r, numStages, det_r[n - 1], n > 1 ? det_r[n - 2] : 0.0, n);
+        }
+    }
+
+    // ==============================================================================
+    // SURROUND BED
+    // Main-bus channels after the front L / R pair (C, LFE, surrounds, heights). The stereo
+    // engine still runs the front pair; the bed shares its decisions rather than its own:
+    // - Detection: every bed channel's key is conditioned like the front pair's (trims, HPF,
+    //   LPF, Thrust; two channels per SIMD pass) and the loudest one is folded into both
+    //   detector lanes, so one linked detector hears the whole bus. The transient designer
+    //   and the M/S detector modes stay front-pair features; an external key replaces the
+    //   bed's as it does the program's
+    // - Gain: each bed channel gets the front pair's gain, fully linked (the lower lane in
+    //   L/R mode, the M/S gain in M/S modes), with the same makeup and auto-gain
+    // - Saturation / Color EQ run per channel on their own state; the LFE bypasses the section,
+    //   so the oversampler only carries the channels that are actually saturated
+    // - Mojo stays on the front pair; SC Audition mutes the bed
+    // ==============================================================================
+
+    // The channels of buf the Saturation oversampler carries (all but the LFE).
+    juce::dsp::AudioBlock<float> saturationChannels(juce::AudioBuffer<float>& buf) noexcept
+    {
+        int k = 0;
+        for (int ch = 0; ch < buf.getNumChannels(); ++ch)
+            if (ch != lfe_channel)
+                sat_os_channels[(size_t)k++] = buf.getWritePointer(ch);
+
+        return juce::dsp::AudioBlock<float>(sat_os_channels.data(), (size_t)k, (size_t)buf.getNumSamples());
+    }
+
+    // Writes the loudest conditioned bed key per sample to sc_det_bed (as |x|) and returns it,
+    // or nullptr when the bed has nothing to add. program holds the bed's program channels.
+    const double* conditionBedSidechain(const juce::AudioBuffer<float>& program, ScPath path, int n) noexcept
+    {
+        const int numCh = program.getNumChannels();
+        if (numCh <= 2)
+            return nullptr;
+
+        // An external key drives the front pair only; with External selected but no bus
+        // connected the front falls back to the program, and so does the bed.
+        const bool internalKey = (path == ScPath::Program || !sc_external_live);
+        if (!internalKey)
+            return nullptr;
+
+        // Unconditioned keys read the program or the dry copy as the front pair's do; the
+        // key follows the input trim while Internal is selected, and SC Level always.
+        const bool sc_internal = (p_sc_input_mode == 0);
+        const double* in_ramp = comp_ramps.ramp(SmCompIn);
+        const double* level_ramp = comp_ramps.ramp(SmScLevel);
+        const juce::AudioBuffer<float>& source = (path == ScPath::Program) ? program : dry_buf;
+
+        double* lane_a = sc_bed_buf.data();
+        double* lane_b = lane_a + max_block;
+        double* det = sc_det_bed.data();
+        std::fill(det, det + n, 0.0);
+
+        for (int ch = 2; ch < numCh; ch += 2)
+        {
+            const bool pair = (ch + 1 < numCh);
+            const float* key_a = source.getReadPointer(ch);
+            const float* key_b = pair ? source.getReadPointer(ch + 1) : nullptr;
+
+            if (path == ScPath::Program)
+            {
+                for (int i = 0; i < n; ++i) {
+                    lane_a[i] = (double)key_a[i];
+                    lane_b[i] = pair ? (double)key_b[i] : 0.0;
+                }
+            }
+            else
+            {
+                for (int i = 0; i < n; ++i) {
+                    const double trim = sc_internal ? (in_ramp ? in_ramp[i] : comp_in_sm) : 1.0;
+                    const double g = trim * (level_ramp ? level_ramp[i] : sc_level_sm);
+                    lane_a[i] = (double)key_a[i] * g;
+                    lane_b[i] = pair ? (double)key_b[i] * g : 0.0;
+                }
+            }
+
+            if (path == ScPath::KeyConditioned)
+            {
+                // An odd bed's last channel runs next to the spare (silent) entry of sc_bed.
+                auto& a = sc_bed[(size_t)(ch - 2)];
+                auto& b = sc_bed[(size_t)(ch - 1)];
+                SimpleBiquad* const chain_a[] = { &a.hp, &a.hp_2, &a.lp, &a.lp_2, &a.shelf };
+                SimpleBiquad* const chain_b[] = { &b.hp, &b.hp_2, &b.lp, &b.lp_2, &b.shelf };
+                filterSidechainLanes(chain_a, chain_b, lane_a, lane_b, n);
+            }
+
+            for (int i = 0; i < n; ++i)
+                det[i] = std::max(det[i], std::max(std::abs(lane_a[i]), std::abs(lane_b[i])));
+        }
+
+        return det;
+    }
+
+    // Applies the linked gain the compressor kernel left in bed_gain to the bed channels of io.
+    void applyBedGain(juce::AudioBuffer<float>& io, int n) noexcept
+    {
+        const double* g = bed_gain.data();
+        for (int ch = 2; ch < io.getNumChannels(); ++ch)
+        {
+            float* x = io.getWritePointer(ch);
+            for (int i = 0; i < n; ++i)
+                x[i] = (float)((double)x[i] * g[i]);
+        }
+    }
+
+    // Final dry / wet mix of one bed channel. Runs before the front pair's mixer, replaying the
+    // topology ramp from the same starting point so every channel fades in together.
+    void mixBedChannel(float* out, const float* wet, const float* dry, float outGain, int n) noexcept
+    {
+        double ramp = topologyRamp;
+        int i = 0;
+        for (; i < n && ramp < 1.0; ++i)
+        {
+            ramp = std::min(1.0, ramp + topologyInc);
+            const float wm = (float)(drywet_sm * ramp);
+            const float dm = 1.0f - wm;
+            out[i] = (wet[i] * wm + dry[i] * dm) * outGain;
+        }
+
+        if (i < n)
+        {
+            const float wm = (float)drywet_sm;
+            MixBusSimd::mixMeter(wet + i, dry + i, nullptr, wm, 1.0f - wm, 0.0f, outGain, out + i, n - i);
+        }
+    }
+
+    // ==============================================================================
+    // QUALITY MODES
+    // Each mode is a fixed oversampler for the Saturation path, chosen for its latency:
+    // - Live: 2x, polyphase IIR at its short setting (a few samples, minimum-phase-like)
+    // - Mix: 4x polyphase IIR at max quality (the original voicing)
+    // - Master: 8x equiripple FIR, linear phase, the longest latency
+    // The reported latency belongs to the mode, not to the modules: with Saturation off the
+    // path still gets the same delay (see processSaturationBlock), so a bypass never asks the
+    // host to recompensate.
+    // Only the running mode is allocated. prepare() builds it; a change mid-stream is built
+    // on the shared worker (OversamplingStage), handed over at the start of a block and faded
+    // in as a topology change, and the retired oversampler is freed back on the worker.
+    // Without a worker, a new mode takes effect at the next prepare().
+    // ==============================================================================
+
+    // Points the Saturation path and the aligners at os_path; clears their state.
+    void selectQualityMode() noexcept
+    {
+        auto& path = *os_path;
+        active_quality_mode = path.mode;
+
+        os = path.os.get();
+        os_stages = path.stages;
+        os_factor = 1 << os_stages;
+        os_latency_samples = path.latency;
+        if (os) os->reset();
+
+        dry_align.setPath(path.latency, path.response.data(), (int)path.response.size());
+        sat_align.setPath(path.latency, path.response.data(), (int)path.response.size());
+        audition_align.setPath(path.latency, nullptr, 0);
+
+        dirty_groups |= MixBusDirty::OsRate | MixBusDirty::Harm;
+    }
+
+    // ==============================================================================
+    // RENDER PROFILE
+    // While the host renders offline (setNonRealtime) and Render Quality is Upgrade, the
+    // CPU-saving settings give way to the most accurate ones, whatever the session uses for
+    // playback:
+    // - Master oversampling (see QUALITY MODES)
+    // - Full-rate detector, control layer at every detector step
+    // - Reference gain curve instead of the table, exact atanh / exp2 in the SC transient designer
+    // The profile changes the Quality mode, so it changes the latency, and a bounce has to run
+    // it from its first sample. So it is only armed by a prepare() that runs offline: prepare
+    // builds straight into it and the processor reports its latency before the first block.
+    // Hosts that go offline without re-preparing (the AU offline-render property, for one)
+    // render with the playback settings throughout; going back online drops the profile.
+    // ==============================================================================
+
+    bool renderUpgradeFor(const ParameterSnapshot& s) const noexcept
+    {
+        return render_armed && offline_render.load(std::memory_order_relaxed)
+            && s.getChoice(MixBusParams::render_quality) == 1;
+    }
+
+    static int qualityModeFor(const ParameterSnapshot& s, bool upgrade) noexcept
+    {
+        return upgrade ? numQualityModes - 1 : juce::jlimit(0, numQualityModes - 1, s.getChoice(MixBusParams::quality_mode));
+    }
+
+    // ==============================================================================
+    // LATENCY ALIGNMENT
+    // Everything that runs beside the oversampled Saturation path is delayed to meet it
+    // rather than sent through a second oversampler. Without the nonlinearity the up / down
+    // round trip is linear and time-invariant, so its impulse response, measured once when
+    // the oversampler is built (OversamplingPath::build), says everything about it:
+    // - Where the parallel path is summed with the saturated one (global Dry/Wet, Mojo's
+    //   source, Saturation Mix) and can be heard, it goes through that response as an FIR,
+    //   which reproduces the half-band filters' phase as the second oversampler used to
+    // - Otherwise (100% wet, the auto-gain reference, the SC Audition) only the timing
+    //   matters, and an integer delay of the reported latency does it
+    // Both modes read one input history, so a path changes mode without a seam.
+    // ==============================================================================
+
+    void resetLatencyAlignment() noexcept
+    {
+        dry_align.reset();
+        sat_align.reset();
+        audition_align.reset();
+    }
+
+    // ==============================================================================
+    // LOOKAHEAD
+    // The compressor's program (and, to stay aligned, the dry path) is delayed by L samples
+    // while the detector keeps listening to the undelayed key, so gain reduction can be in
+    // place when a peak arrives instead of starting on it. The peak detector also holds the
+    // loudest |x| of the last L + 1 samples (SlidingWindowMax), so the envelope spends the
+    // whole lookahead attacking towards a peak rather than only its last moments; the RMS
+    // detector's window already integrates ahead and just gets the early key. Changing the
+    // length is a latency change and goes through the topology fade.
+    // ==============================================================================
+    static constexpr float maxLookaheadMs = 10.0f;
+
+    void resetLookahead(int samples) noexcept
+    {
+        la_samples = samples;
+        la_det_l.setWindow(samples + 1);
+        la_det_r.setWindow(samples + 1);
+        la_det_bed.setWindow(samples + 1);
+        la_det_l.reset();
+        la_det_r.reset();
+        la_det_bed.reset();
+        la_wet.setDelay(samples);
+        la_dry.setDelay(samples);
+        la_wet.reset();
+        la_dry.reset();
+    }
+
+    // Runs between the detector conditioning and the compressor kernel: delays the program
+    // and turns the peak detector's feed into its look-ahead window maximum.
+    void applyLookahead(juce::AudioBuffer<float>& io, bool bed, int n) noexcept
+    {
+        if (!use_rms)
+        {
+            double* det_l = sc_det_l.data();
+            double* det_r = sc_det_r.data();
+            for (int i = 0; i < n; ++i) {
+                det_l[i] = std::abs(det_l[i]);
+                det_r[i] = std::abs(det_r[i]);
+            }
+
+            la_det_l.process(det_l, n);
+            la_det_r.process(det_r, n);
+            if (bed)
+                la_det_bed.process(sc_det_bed.data(), n);
+        }
+
+        la_wet.process(io.getArrayOfWritePointers(), io.getNumChannels(), n);
+    }
+
+    // ==============================================================================
+    // MULTIRATE DETECTOR (Detector Rate = Control)
+    // From 88.2 kHz up, the detector, control layer and gain computer step at det_rate =
+    // s_rate / D, with D = round(s_rate / 48 kHz) (at most 8); the audio path stays at full rate.
+    // - Peak mode samples the conditioned (and feedback-mixed) feed once per step, the view a
+    //   48 kHz session's detector has; max-of-step or averaging would bias broadband material
+    //   by tenths of a dB. RMS mode feeds each step its D samples' mean power, so the window
+    //   sum matches the full-rate one
+    // - Attack / release, auto-release, crest and flux decay and the RMS window are designed at
+    //   det_rate, so their time constants keep their nominal values
+    // - The step's linear gain is ramped across the next D samples. Gain changes therefore land
+    //   one control period late (1 / det_rate, ~20.8 us at 96 / 192 kHz), an attack cannot settle
+    //   faster than one period, and RMS windows round to whole periods
+    // ==============================================================================
+    static constexpr double detectorControlRate = 48000.0;
+    static constexpr int maxDetectorDecimation = 8;
+
+    void resetControlRateState() noexcept
+    {
+        cr_phase = 0;
+        cr_acc_lr = Double2::broadcast(0.0);
+        cr_gain_cur_lr = (p_ms_mode == 0) ? MixBusSimd::dbToLin<mathAccuracy>(env_lr) : Double2::broadcast(dbToLin(env));
+        cr_gain_prev_lr = cr_gain_cur_lr;
+    }
+
+    // ==============================================================================
+    // CONTROL LAYER (TP / Auto Crest / Flux)
+    // These only nudge the threshold and ratio, so their followers run every detector step in
+    // the linear domain and the dB metrics are evaluated once per control period (Control Layer
+    // Rate; "Detector" evaluates every step). The offsets are ramped across the following period.
+    // - TP: clamping dB(env / avg) to 0..24 dB is clamping avg to [env - 24 dB, env]. The period
+    //   uses its loudest avg, i.e. the smallest per-step metric: in peak mode the metric rides
+    //   the waveform and the envelope's attack follows its dips, so a mean would under-compress
+    // - Auto Crest: peak / power followers per step; crest and the cf_amt integration per period
+    // - Flux: the period's peak level against a -24 dB floor, one log above it, decay^interval
+    // - A threshold offset alone is a detector level scale, so the gain computer stays on the
+    //   table unless Auto Crest is moving the ratio
+    // ==============================================================================
+    static constexpr std::array<double, 4> controlLayerRates { 0.0, 4000.0, 2000.0, 1000.0 };
+    static constexpr int maxControlLayerInterval = 192; // 1 kHz at 192 kHz
+    static constexpr double tpRangeLin = 0.063095734448019325; // -24 dB
+    static constexpr double fluxFloorLin = 0.063095734448019325; // -24 dB: flux metric is 0 below
+
+    void evaluateControlLayer() noexcept
+    {
+        double thresh_off = 0.0;
+
+        if (tp_enabled)
+        {
+            const double env_lvl = det_env + 1e-20;
+            const double tp_metric = linToDb(env_lvl / juce::jlimit(env_lvl * tpRangeLin, env_lvl, cl_tp_avg_peak + 1e-20)) / 24.0;
+            thresh_off += tp_metric * tp_amt * tp_raise_db;
+            cl_tp_avg_peak = 0.0;
+        }
+
+        if (p_ctrl_mode == 1)
+        {
+            const double rms = std::sqrt(std::max(0.0, cf_rms_sum));
+            const double crest = linToDb((cf_peak_env + 1e-20) / (rms + 1e-20));
+
+            const double err = crest - crest_target_db;
+            const double cf_step = (1.0 - crest_coeff) * 0.002 * (double)cl_interval;
+            cf_amt = juce::jlimit(0.0, 1.0, cf_amt + err * cf_step);
+            thresh_off -= cf_amt * 3.0;
+        }
+
+        if (flux_enabled)
+        {
+            const double meas_pk = cl_flux_peak * sat_drive_lin_sm;
+            const double metric = (meas_pk > fluxFloorLin)
+                ? juce::jlimit(0.0, 1.0, (linToDb(meas_pk) - (-24.0)) / 24.0)
+                : 0.0;
+            flux_env = std::max(metric, flux_env * cl_flux_decay);
+            thresh_off += flux_env * (6.0 * flux_amt);
+            cl_flux_peak = 0.0;
+        }
+
+        cl_thresh_prev = cl_thresh_cur;  cl_thresh_cur = thresh_off;
+        cl_ratio_prev = cl_ratio_cur;    cl_ratio_cur = 1.0 + cf_amt * 2.0;
+        cl_scale_prev = cl_scale_cur;    cl_scale_cur = dbToLin(-thresh_off);
+        cl_phase = 0;
+    }
+
+    void resetControlLayerState() noexcept
+    {
+        cl_phase = 0;
+        cl_tp_avg_peak = 0.0;
+        cl_flux_peak = 0.0;
+        cl_thresh_prev = cl_thresh_cur = 0.0;
+        cl_ratio_prev = cl_ratio_cur = 1.0;
+        cl_scale_prev = cl_scale_cur = 1.0;
+    }
+
+    // ==============================================================================
+    // COMPRESSOR KERNELS
+    // The per-sample loop is instantiated per configuration, so each variant carries only the
+    // work its modes need; processCompressorBlock picks one per block from a table.
+    //   Stereo       ms_mode == 0 (per-channel detector and gains) vs. the single-detector M/S modes
+    //   Rms          RMS window vs. peak detection
+    //   ControlLayer TP / crest / flux (active_tf)
+    //   Multirate    detector steps at det_rate (see MULTIRATE DETECTOR)
+    // The detector feed arrives pre-conditioned (see conditionSidechain). Auto-release,
+    // auto-gain and feedback stay runtime: they only pick between cheap block-constant branches.
+    // ==============================================================================
+    struct CompressorBlock
+    {
+        float* l;
+        float* r;
+        const double* det_l;
+        const double* det_r;
+        int numSamples;
+        bool smoothing;
+        double* const* smoothed;
+        const double* bed_det = nullptr; // surround bed: loudest bed key as |x|, or nullptr
+        double* bed_gain = nullptr;      // surround bed: linked gain out, makeup and auto-gain included
+        bool det_rectified = false;      // det_l / det_r hold |x| (the lookahead window max)
+        double sum_in_rms = 0.0;  // auto-gain: post input gain
+        double sum_out_rms = 0.0; // auto-gain: post GR, pre makeup
+    };
+
+    using CompressorKernel = void (UltimateCompDSP::*)(CompressorBlock&);
+
+    static constexpr std::size_t compressorKernelIndex(bool stereo, bool rms, bool controlLayer, bool multirate) noexcept
+    {
+        return (stereo ? 1u : 0u) | (rms ? 2u : 0u) | (controlLayer ? 4u : 0u) | (multirate ? 8u : 0u);
+    }
+
+    template <std::size_t... I>
+    static constexpr std::array<CompressorKernel, sizeof...(I)> makeCompressorKernels(std::index_sequence<I...>) noexcept
+    {
+        return { &UltimateCompDSP::compressorKernel<(I & 1u) != 0, (I & 2u) != 0, (I & 4u) != 0, (I & 8u) != 0>... };
+    }
+
+    void processCompressorBlock(juce::AudioBuffer<float>& io)
+    {
+        const int nSamp = io.getNumSamples();
+
+        // TRUE BYPASS: If the Dynamics module is bypassed, do not touch the program signal.
+        // This guarantees null/bit-transparent behavior for "all modules bypassed" scenarios.
+        if (!p_active_dyn)
+        {
+            det_env = 0.0; env = 0.0;
+            env_lr = env_fast_lr = env_slow_lr = Double2::broadcast(0.0);
+            env_fast = env_slow = 0.0;
+            resetControlRateState();
+            fb_prev_l = fb_prev_r = 0.0;
+
+            // The lookahead delay stays in, so bypassing Dynamics does not move the timing
+            la_wet.process(io.getArrayOfWritePointers(), io.getNumChannels(), nSamp);
+            return;
+        }
+
+        // Control smoothing: settled values stay constant for the block, moving ones read their ramp.
+        const auto smoothed = compSmoothedValues();
+        const bool smoothing = beginCompRamps(CompRampBank::allValues, nSamp, smoothed.data());
+
+        // Once threshold / ratio / knee have settled, rebuild the gain-computer table (no-op if unchanged).
+        constexpr std::uint32_t curveValues = (1u << SmThresh) | (1u << SmRatio) | (1u << SmKnee);
+        if ((comp_ramps.movingMask() & curveValues) == 0)
+            gain_table.setCurve(thresh_sm, ratio_sm, knee_sm);
+
+        float* l = io.getWritePointer(0);
+        float* r = io.getWritePointer(1);
+
+        // 1. Input gain (drive), ahead of everything that listens to the program
+        const double* in_ramp = comp_ramps.ramp(SmCompIn);
+        for (int i = 0; i < nSamp; ++i) {
+            const float in_gain = (float)(in_ramp ? in_ramp[i] : comp_in_sm);
+            l[i] *= in_gain;
+            r[i] *= in_gain;
+        }
+
+        for (int ch = 2; ch < io.getNumChannels(); ++ch) {
+            float* x = io.getWritePointer(ch);
+            for (int i = 0; i < nSamp; ++i)
+                x[i] *= (float)(in_ramp ? in_ramp[i] : comp_in_sm);
+        }
+
+        // 2. Detector feed for the whole block
+        const bool stereo = (p_ms_mode == 0);
+        const ScPath path = sidechainPath();
+        conditionSidechain(l, r, path, stereo, nSamp);
+
+        // 3. Serial part: detector, envelope and gain
+        CompressorBlock block { l, r, sc_det_l.data(), sc_det_r.data(), nSamp, smoothing, smoothed.data() };
+        if (io.getNumChannels() > 2)
+        {
+            block.bed_det = conditionBedSidechain(io, path, nSamp);
+            block.bed_gain = bed_gain.data();
+        }
+
+        if (la_samples > 0)
+        {
+            applyLookahead(io, block.bed_det != nullptr, nSamp);
+            block.det_rectified = !use_rms;
+        }
+
+        static constexpr auto kernels = makeCompressorKernels(std::make_index_sequence<16>{});
+        (this->*kernels[compressorKernelIndex(stereo, use_rms, p_active_tf, det_decimation > 1)])(block);
+
+        if (block.bed_gain != nullptr)
+            applyBedGain(io, nSamp);
+
+        const double sum_in_rms = block.sum_in_rms;
+        const double sum_out_rms = block.sum_out_rms;
+
+        // --- COMPRESSOR AUTO-GAIN LOGIC (Block Level) ---
+        if (p_comp_autogain_mode > 0 && sum_in_rms > 1e-12) {
+            double rms_in = std::sqrt(sum_in_rms / (double)(nSamp * 2));
+            double rms_out = std::sqrt(sum_out_rms / (double)(nSamp * 2)); // This is Post-GR, Pre-Makeup
 
             // Only update gain if signal is above noise floor (-60dB)
             if (rms_in > 0.001) {
@@ -1029,256 +2051,310 @@ private:
 
 
 
-    void processAuditionBlock(juce::AudioBuffer<float>& buf)
+    template <bool Stereo, bool Rms, bool ControlLayer, bool Multirate>
+    void compressorKernel(CompressorBlock& b)
     {
-        const int nSamp = buf.getNumSamples();
-        auto* l = buf.getWritePointer(0);
-        auto* r = buf.getNumChannels() > 1 ? buf.getWritePointer(1) : nullptr;
+        float* l = b.l;
+        float* r = b.r;
 
-        for (int i = 0; i < nSamp; ++i)
+        const bool autogain = (p_comp_autogain_mode > 0);
+        const bool feedback = (fb_blend > 0.0);
+        const int step = det_decimation;
+        const double inv_step = 1.0 / (double)step;
+
+        double sum_in_rms = 0.0;
+        double sum_out_rms = 0.0;
+
+        for (int i = 0; i < b.numSamples; ++i)
         {
-            // Maintain the same basic gain smoothing behavior as the main path
-            comp_in_sm = smooth1p(comp_in_sm, comp_in_target, smooth_alpha);
-            sc_level_sm = smooth1p(sc_level_sm, sc_level_target, smooth_alpha);
+            if (b.smoothing) comp_ramps.load(b.smoothed, i);
 
-            // --- ADD THESE TWO LINES ---
-            sc_td_amt_sm = smooth1p(sc_td_amt_sm, sc_td_amt_target, smooth_alpha);
-            sc_td_ms_sm = smooth1p(sc_td_ms_sm, sc_td_ms_target, smooth_alpha);
-            // ---------------------------
+            // RMS Input Measurement (Post-Input Gain, Pre-GR)
+            if (autogain) {
+                sum_in_rms += (double)l[i] * (double)l[i] + (double)r[i] * (double)r[i];
+            }
 
-            // Pull sidechain source (internal/external)
-            double s_l = (double)sc_internal_buf.getSample(0, i);
-            double s_r = (double)((sc_internal_buf.getNumChannels() > 1) ? sc_internal_buf.getSample(1, i) : sc_internal_buf.getSample(0, i));
+            // --- 3. DETECTOR ---
+            double det_in_l = b.det_l[i];
+            double det_in_r = b.det_r[i];
+
+            // FIXED: Feedback uses fb_prev stored BEFORE makeup gain.
+            // Skipped at 0% so each sample's detector input does not wait on the previous output.
+            // A rectified feed blends with the output's magnitude, not its signed sample.
+            if (feedback) {
+                const double fb_l = b.det_rectified ? std::abs(fb_prev_l) : fb_prev_l;
+                const double fb_r = b.det_rectified ? std::abs(fb_prev_r) : fb_prev_r;
+                det_in_l = det_in_l * (1.0 - fb_blend) + fb_l * fb_blend;
+                det_in_r = det_in_r * (1.0 - fb_blend) + fb_r * fb_blend;
+            }
 
-            // If "Key to Comp" is disabled, detector hears the program input
-            if (!p_sc_to_comp)
-            {
-                s_l = (double)l[i];
-                s_r = (double)(r ? r[i] : l[i]);
+            // The detector only hears magnitudes, so the bed joins both lanes as a max of |x|
+            if (b.bed_det) {
+                det_in_l = std::max(std::abs(det_in_l), b.bed_det[i]);
+                det_in_r = std::max(std::abs(det_in_r), b.bed_det[i]);
             }
-            else
-            {
-                // Apply SC level trim
-                s_l *= sc_level_sm;
-                s_r *= sc_level_sm;
 
-                // Internal SC: respect input trim (so audition matches detector behavior)
-                if (p_sc_input_mode == 0)
-                {
-                    s_l *= comp_in_sm;
-                    s_r *= comp_in_sm;
-                }
+            Double2 gain_lr = Double2::broadcast(1.0); // unity until this step sets it (mono full-rate never does)
 
-                if (p_active_det)
-                {
-                    // HPF/LPF - FIXED: Changed scHP_L to sc_hp_l etc to match class members
-                    s_l = sc_hp_l_2.process(sc_hp_l.process(s_l));
-                    s_r = sc_hp_r_2.process(sc_hp_r.process(s_r));
-                    s_l = sc_lp_l_2.process(sc_lp_l.process(s_l));
-                    s_r = sc_lp_r_2.process(sc_lp_r.process(s_r));
-
-                    // Thrust voicing
-                    if (p_thrust_mode != 0) {
-                        s_l = sc_shelf_l.process(s_l);
-                        s_r = sc_shelf_r.process(s_r);
-                    }
+            if constexpr (Multirate) {
+                // The gain ramps towards the last step's result while this step's samples come in.
+                const Double2 x = Double2::set(det_in_l, det_in_r);
+                if constexpr (Rms) cr_acc_lr = cr_acc_lr + x * x;
+
+                gain_lr = cr_gain_prev_lr + (cr_gain_cur_lr - cr_gain_prev_lr) * ((double)++cr_phase * inv_step);
+
+                if (cr_phase == step) {
+                    Double2 det_step;
+                    if constexpr (Rms) det_step = Double2::sqrt(cr_acc_lr * inv_step);
+                    else               det_step = Double2::abs(x);
+                    runDetector<Stereo, Rms, ControlLayer>(det_step.lane0(), det_step.lane1());
+                    gr_block_lo = std::min(gr_block_lo, env);
+                    gr_block_hi = std::max(gr_block_hi, env);
+
+                    cr_gain_prev_lr = cr_gain_cur_lr;
+                    if constexpr (Stereo) cr_gain_cur_lr = MixBusSimd::dbToLin<mathAccuracy>(env_lr);
+                    else                  cr_gain_cur_lr = Double2::broadcast(dbToLin(env));
+                    cr_acc_lr = Double2::broadcast(0.0);
+                    cr_phase = 0;
                 }
+            }
+            else {
+                runDetector<Stereo, Rms, ControlLayer>(det_in_l, det_in_r);
+                gr_block_lo = std::min(gr_block_lo, env);
+                gr_block_hi = std::max(gr_block_hi, env);
 
-                // Sidechain transient designer (post filters)
-                if (p_active_det)
-                    applySidechainTransientDesigner(s_l, s_r);
+                if constexpr (Stereo) gain_lr = MixBusSimd::dbToLin<mathAccuracy>(env_lr);
+            }
 
+            // --- 4. APPLY GAIN REDUCTION ---
+            // Apply GR first (Pre-Makeup)
+            const double in_l = (double)l[i];
+            const double in_r = (double)r[i];
+            double pre_make_l, pre_make_r;
+            double bed_lin = 1.0;
+
+            if constexpr (Stereo) {
+                const Double2 pre_make = Double2::set(in_l, in_r) * gain_lr;
+                pre_make_l = pre_make.lane0();
+                pre_make_r = pre_make.lane1();
+                if (b.bed_gain) bed_lin = std::min(gain_lr.lane0(), gain_lr.lane1());
             }
+            else {
+                const double lin_gain_mono = Multirate ? gain_lr.lane0() : dbToLin(env);
+                bed_lin = lin_gain_mono;
+                double mid = (in_l + in_r) * 0.5;
+                double side = (in_l - in_r) * 0.5;
+                if (p_ms_mode == 1 || p_ms_mode == 4) mid *= lin_gain_mono;
+                else side *= lin_gain_mono;
 
-            // M/S detector selection (affects what you hear in audition)
-            double det_in_l = s_l;
-            double det_in_r = s_r;
+                // NEW: M/S balance tilt for cross-modes (keeps energy roughly consistent)
+                if (p_ms_mode == 3) { mid *= (1.0 / ms_bal_sm); side *= ms_bal_sm; }
+                else if (p_ms_mode == 4) { mid *= ms_bal_sm; side *= (1.0 / ms_bal_sm); }
+                pre_make_l = mid + side;
+                pre_make_r = mid - side;
+            }
 
-            if (p_ms_mode > 0)
-            {
-                const double mid = (s_l + s_r) * 0.5;
-                const double side = (s_l - s_r) * 0.5;
+            // Store Feedback Tap (Pre-Makeup)
+            fb_prev_l = pre_make_l;
+            fb_prev_r = pre_make_r;
 
-                if (p_ms_mode == 1) { det_in_l = det_in_r = mid; }
-                else if (p_ms_mode == 2) { det_in_l = det_in_r = side; }
-                else if (p_ms_mode == 3) { det_in_l = det_in_r = mid; }   // M>S: detect Mid
-                else if (p_ms_mode == 4) { det_in_l = det_in_r = side; }  // S>M: detect Side
+            // RMS Output Measurement (Pre-Makeup)
+            if (autogain) {
+                sum_out_rms += pre_make_l * pre_make_l + pre_make_r * pre_make_r;
             }
 
-            l[i] = (float)det_in_l;
-            if (r) r[i] = (float)det_in_r;
+            // 5. Apply Makeup & Auto-Gain
+            // (UI mirror handles comp I/O linking; no additional DSP mirroring.)
+            const double final_agc = (double)comp_agc_gain_sm;
+            l[i] = (float)(pre_make_l * makeup_lin_sm * final_agc);
+            r[i] = (float)(pre_make_r * makeup_lin_sm * final_agc);
+            if (b.bed_gain) b.bed_gain[i] = bed_lin * makeup_lin_sm * final_agc;
         }
-    }
 
+        b.sum_in_rms = sum_in_rms;
+        b.sum_out_rms = sum_out_rms;
+    }
 
-    void runDetector(double s_l, double s_r)
+    void processAuditionBlock(juce::AudioBuffer<float>& buf)
     {
-        // Detector raw (pre-link)
-        double det_l_raw = 0.0, det_r_raw = 0.0;
+        const int nSamp = buf.getNumSamples();
+        auto* l = buf.getWritePointer(0);
+        auto* r = buf.getNumChannels() > 1 ? buf.getWritePointer(1) : nullptr;
+
+        // Maintain the same basic gain smoothing behavior as the main path
+        const auto smoothed = compSmoothedValues();
+        const std::uint32_t auditionSmoothed = (1u << SmCompIn) | (1u << SmScLevel) | (1u << SmTdAmt) | (1u << SmTdMs);
+        const bool smoothing = beginCompRamps(auditionSmoothed, nSamp, smoothed.data());
 
-        if (use_rms) {
-            const double pL = s_l * s_l;
-            const double pR = s_r * s_r;
+        // Monitor exactly what the detector would hear (program path: the untrimmed program)
+        conditionSidechain(l, r ? r : l, sidechainPath(), p_ms_mode == 0, nSamp);
 
-            rms_sum_l += pL - rms_ring_l[(size_t)rms_pos];
-            rms_sum_r += pR - rms_ring_r[(size_t)rms_pos];
+        if (smoothing) comp_ramps.load(smoothed.data(), nSamp - 1);
+
+        for (int i = 0; i < nSamp; ++i) {
+            l[i] = (float)sc_det_l[(size_t)i];
+            if (r) r[i] = (float)sc_det_r[(size_t)i];
+        }
+
+        // The audition monitors the front pair's key; the bed stays silent
+        for (int ch = 2; ch < buf.getNumChannels(); ++ch)
+            buf.clear(ch, 0, nSamp);
+
+        // Same timing as the compressed program
+        la_wet.process(buf.getArrayOfWritePointers(), buf.getNumChannels(), nSamp);
+    }
 
-            rms_ring_l[(size_t)rms_pos] = pL;
-            rms_ring_r[(size_t)rms_pos] = pR;
 
-            rms_pos++; if (rms_pos >= rms_window) rms_pos = 0;
+    template <bool Stereo, bool Rms, bool ControlLayer>
+    void runDetector(double s_l, double s_r)
+    {
+        // Detector raw (pre-link), both channels at once
+        const Double2 s_lr = Double2::set(s_l, s_r);
+        Double2 det_raw;
+
+        if constexpr (Rms) {
+            // Powers are stored as float, and the sums take the same rounded value that will
+            // later be subtracted.
+            float* slot = rms_ring.data() + (size_t)rms_pos * 2;
+            const Double2 p = Double2::roundToFloat(s_lr * s_lr);
+
+            rms_sum_lr = rms_sum_lr + (p - Double2::loadFloat(slot));
+            rms_lap_lr = rms_lap_lr + p;
+            p.storeFloat(slot);
+
+            rms_pos++;
+            if (rms_pos >= rms_window) {
+                // Every slot was rewritten during this lap, so the lap's sum is the window sum
+                // without the add / subtract rounding the running sum has picked up. Swapping it
+                // in bounds the drift to one lap.
+                rms_pos = 0;
+                rms_sum_lr = rms_lap_lr;
+                rms_lap_lr = Double2::broadcast(0.0);
+            }
 
-            det_l_raw = std::sqrt(std::max(0.0, rms_sum_l / (double)rms_window));
-            det_r_raw = std::sqrt(std::max(0.0, rms_sum_r / (double)rms_window));
+            det_raw = Double2::sqrt(Double2::max(rms_sum_lr / (double)rms_window, Double2::broadcast(0.0)));
         }
         else {
-            det_l_raw = std::abs(s_l);
-            det_r_raw = std::abs(s_r);
+            det_raw = Double2::abs(s_lr);
         }
 
-        const double det_avg = std::sqrt(0.5 * (det_l_raw * det_l_raw + det_r_raw * det_r_raw));
+        const double det_l_raw = det_raw.lane0();
+        const double det_r_raw = det_raw.lane1();
+
         const double det_max = std::max(det_l_raw, det_r_raw);
 
         // Global detector value for control-layer options (TP / Crest / Flux)
         const double det = det_max;
 
         double eff_thresh_db = thresh_sm;
-        if (p_active_tf && tp_enabled)
+        double eff_ratio = ratio_sm;
+        double level_scale = 1.0; // the threshold offset as a detector level scale (table path)
+
+        if constexpr (ControlLayer)
         {
-            const double pk = det_max;
-            const double det_fast = (pk > det_env)
-                ? (att_coeff * det_env + (1.0 - att_coeff) * pk)
-                : (auto_rel_fast * det_env + (1.0 - auto_rel_fast) * pk);
-            det_env = det_fast;
+            // Linear-domain followers every step; the metrics are evaluated per control period.
+            if (tp_enabled)
+            {
+                const double det_avg = std::sqrt(0.5 * (det_l_raw * det_l_raw + det_r_raw * det_r_raw));
+                const double pk = det_max;
+                const double det_fast = (pk > det_env)
+                    ? (att_coeff * det_env + (1.0 - att_coeff) * pk)
+                    : (auto_rel_fast * det_env + (1.0 - auto_rel_fast) * pk);
+                det_env = det_fast;
+
+                cl_tp_avg_peak = std::max(cl_tp_avg_peak, det_avg);
+            }
 
-            const double tp_metric = juce::jlimit(0.0, 1.0, (linToDb(det_env + 1e-20) - linToDb(det_avg + 1e-20)) / 24.0);
-            const double tp_boost = tp_metric * tp_amt * tp_raise_db;
-            eff_thresh_db += tp_boost;
-        }
-        else {
-            if (!p_active_tf) det_env = 0.0;
-        }
+            if (p_ctrl_mode == 1)
+            {
+                // Crest-factor thresh/ratio (optional)
+                cf_peak_env = std::max(det_max, cf_peak_env * crest_coeff);
+                cf_rms_sum = smooth1p(cf_rms_sum, 0.5 * (det_l_raw * det_l_raw + det_r_raw * det_r_raw), crest_coeff);
+            }
+            else {
+                cf_amt = 0.0;
+            }
 
-        double eff_ratio = ratio_sm;
-        if (p_active_tf && p_ctrl_mode == 1)
-        {
-            // Crest-factor thresh/ratio (optional)
-            const double crest_coeff_local = crest_coeff;
-            cf_peak_env = std::max(det_max, cf_peak_env * crest_coeff_local);
-            const double rms_p = det_avg * det_avg;
-            cf_rms_sum = smooth1p(cf_rms_sum, rms_p, crest_coeff_local);
-            const double rms = std::sqrt(std::max(0.0, cf_rms_sum));
-            const double crest = linToDb((cf_peak_env + 1e-20) / (rms + 1e-20));
+            if (flux_enabled)
+                cl_flux_peak = std::max(cl_flux_peak, det_max);
 
-            const double err = crest - crest_target_db;
-            const double cf_step = (1.0 - crest_coeff_local) * 0.002;
-            cf_amt = juce::jlimit(0.0, 1.0, cf_amt + err * cf_step);
+            if (++cl_phase == cl_interval)
+                evaluateControlLayer();
 
-            eff_ratio = ratio_sm * (1.0 + cf_amt * 2.0);
-            eff_thresh_db -= cf_amt * 3.0;
+            const double w = (double)(cl_phase + 1) * cl_inv_interval;
+            eff_thresh_db += cl_thresh_prev + (cl_thresh_cur - cl_thresh_prev) * w;
+            eff_ratio *= cl_ratio_prev + (cl_ratio_cur - cl_ratio_prev) * w;
+            level_scale = cl_scale_prev + (cl_scale_cur - cl_scale_prev) * w;
         }
-        else {
-            cf_amt = 0.0;
-        }
-
-        if (p_active_tf && flux_enabled)
+        else
         {
-            const double drive = sat_drive_lin_sm;
-            const double meas_pk = det_max * drive;
-            const double meas_db = linToDb(meas_pk + 1e-20);
-            const double metric = juce::jlimit(0.0, 1.0, (meas_db - (-24.0)) / 24.0);
-            flux_env = std::max(metric, flux_env * 0.995);
-            eff_thresh_db += flux_env * (6.0 * flux_amt);
-        }
-        else {
-            if (!p_active_tf) flux_env = 0.0;
+            // Off: turning it back on starts from zero offsets, not the last period's
+            det_env = 0.0;
+            cf_amt = 0.0;
+            flux_env = 0.0;
+            resetControlLayerState();
         }
 
-        auto compute_gr_db = [&](double det_db) -> double
+        // Static curve: table lookup straight from the detector level while the curve is the one
+        // the table was built for; a control-layer threshold offset shifts the level instead.
+        // Auto Crest's ratio modulation, and the render profile, use the reference curve.
+        const bool tabulated = !render_upgrade && (eff_ratio == ratio_sm) && gain_table.matches(thresh_sm, ratio_sm, knee_sm);
+        auto reference_gr = [&](double det_db) -> double
             {
-                const double knee = knee_sm;
-                double gr_db = 0.0;
-
-                if (knee > 0.0) {
-                    const double x = det_db - eff_thresh_db;
-                    const double half = knee * 0.5;
-                    if (x <= -half) gr_db = 0.0;
-                    else if (x >= half) gr_db = -(x - x / eff_ratio);
-                    else {
-                        const double t = (x + half) / knee; // 0..1
-                        const double y = t * t * (3.0 - 2.0 * t); // smoothstep
-                        const double x2 = x - (-half);
-                        const double gr_full = -(x2 - x2 / eff_ratio);
-                        gr_db = gr_full * y;
-                    }
-                }
-                else {
-                    const double x = det_db - eff_thresh_db;
-                    gr_db = (x > 0.0) ? -(x - x / eff_ratio) : 0.0;
-                }
-
-                return gr_db;
+                return GainComputer::gainDb(det_db, eff_thresh_db, eff_ratio, knee_sm);
             };
 
         // --- Stereo link: 0% = dual-mono, 100% = fully linked.
-        if (p_ms_mode == 0)
+        if constexpr (Stereo)
         {
             const double link = stereo_link; // 0..1
 
-            const double det_db_l = linToDb(det_l_raw + 1e-20);
-            const double det_db_r = linToDb(det_r_raw + 1e-20);
-            const double det_db_link = linToDb(det_max + 1e-20);
-
-            const double gr_l_un = compute_gr_db(det_db_l);
-            const double gr_r_un = compute_gr_db(det_db_r);
-            const double gr_link = compute_gr_db(det_db_link);
-
-            const double target_l = gr_l_un + (gr_link - gr_l_un) * link;
-            const double target_r = gr_r_un + (gr_link - gr_r_un) * link;
-
-            // Smooth per channel (attack / release / auto-release)
-            auto updateEnv = [&](double target, double& envC, double& fastC, double& slowC)
-                {
-                    if (target < envC) {
-                        envC = att_coeff * envC + (1.0 - att_coeff) * target;
-                        fastC = envC;
-                        slowC = envC;
-                        rel_coeff = att_coeff;
-                    }
-                    else {
-                        if (p_auto_rel) {
-                            fastC = auto_rel_fast * fastC + (1.0 - auto_rel_fast) * target;
-                            slowC = auto_rel_slow * slowC + (1.0 - auto_rel_slow) * target;
-                            envC = std::min(fastC, slowC);
-                        }
-                        else {
-                            envC = rel_coeff_manual * envC + (1.0 - rel_coeff_manual) * target;
-                            fastC = envC;
-                            slowC = envC;
-                            rel_coeff = rel_coeff_manual;
-                        }
-                    }
-                };
-
-            updateEnv(target_l, env_l, env_fast_l, env_slow_l);
-            updateEnv(target_r, env_r, env_fast_r, env_slow_r);
+            Double2 gr_un, gr_link;
+            if (tabulated) {
+                gr_un = Double2::set(gain_table.gainDb(det_l_raw * level_scale), gain_table.gainDb(det_r_raw * level_scale));
+                gr_link = Double2::broadcast(gain_table.gainDb(det_max * level_scale));
+            }
+            else {
+                // The linked level is the louder channel, so its dB value is already at hand.
+                const double db_l = linToDb(det_l_raw + 1e-20);
+                const double db_r = linToDb(det_r_raw + 1e-20);
+                gr_un = Double2::set(reference_gr(db_l), reference_gr(db_r));
+                gr_link = Double2::broadcast(reference_gr(det_l_raw < det_r_raw ? db_r : db_l));
+            }
+            const Double2 target = gr_un + (gr_link - gr_un) * link;
+
+            // Smooth both channels (attack / release / auto-release), branch-free per lane
+            const Double2 attacking = Double2::lessThan(target, env_lr);
+            const Double2 env_att = att_coeff * env_lr + (1.0 - att_coeff) * target;
+
+            if (p_auto_rel) {
+                const Double2 fast = auto_rel_fast * env_fast_lr + (1.0 - auto_rel_fast) * target;
+                const Double2 slow = auto_rel_slow * env_slow_lr + (1.0 - auto_rel_slow) * target;
+                env_lr = Double2::select(attacking, env_att, Double2::min(fast, slow));
+                env_fast_lr = Double2::select(attacking, env_att, fast);
+                env_slow_lr = Double2::select(attacking, env_att, slow);
+            }
+            else {
+                const Double2 rel = rel_coeff_manual * env_lr + (1.0 - rel_coeff_manual) * target;
+                env_lr = Double2::select(attacking, env_att, rel);
+                env_fast_lr = env_lr;
+                env_slow_lr = env_lr;
+            }
 
-            env = 0.5 * (env_l + env_r);
-            env_fast = 0.5 * (env_fast_l + env_fast_r);
-            env_slow = 0.5 * (env_slow_l + env_slow_r);
+            env = 0.5 * (env_lr.lane0() + env_lr.lane1());
+            env_fast = 0.5 * (env_fast_lr.lane0() + env_fast_lr.lane1());
+            env_slow = 0.5 * (env_slow_lr.lane0() + env_slow_lr.lane1());
         }
         else
         {
             // M/S modes are single-detector (by design), since you are explicitly compressing mid or side.
-            const double det_db = linToDb(det + 1e-20);
-            const double gr_db = compute_gr_db(det_db);
+            const double gr_db = tabulated ? gain_table.gainDb(det * level_scale) : reference_gr(linToDb(det + 1e-20));
 
             const double target = gr_db;
             if (target < env) {
                 env = att_coeff * env + (1.0 - att_coeff) * target;
                 env_fast = env;
                 env_slow = env;
-                rel_coeff = att_coeff;
             }
             else {
                 if (p_auto_rel) {
@@ -1290,20 +2366,35 @@ private:
                     env = rel_coeff_manual * env + (1.0 - rel_coeff_manual) * target;
                     env_fast = env;
                     env_slow = env;
-                    rel_coeff = rel_coeff_manual;
                 }
             }
         }
     }
 
 
-    void processSaturationBlock(juce::AudioBuffer<float>& io)
+    // Color EQ stages (Girth bump / dip, Tone) at 0 dB are elided; this keeps their state on
+    // the signal so a control moved off 0 dB glides in without a step. y is the chain's output.
+    void primeColorEq(int ch, const float* y, int n) noexcept
     {
-        if (!p_active_sat && !p_active_eq) return;
+        if (n <= 0)
+            return;
 
+        auto& c = sat_ch[(size_t)ch];
+        SimpleBiquad* const chain[] = { &c.girth_bump, &c.girth_dip, &c.tone };
+        SimpleBiquad::primeElidedStages(chain, 3, (double)y[n - 1], n > 1 ? (double)y[n - 2] : 0.0, n);
+    }
+
+    void processSaturationBlock(juce::AudioBuffer<float>& io)
+    {
         const int nCh = io.getNumChannels();
         const int nS = io.getNumSamples();
 
+        // Saturation off: the oversampler's latency is kept as a plain delay (see QUALITY MODES)
+        if (!p_active_sat && os)
+            sat_align.process(io.getArrayOfWritePointers(), nCh, nS, false);
+
+        if (!p_active_sat && !p_active_eq) return;
+
         // ----------------------------------------------------------------------
         // EQ-only path: when Saturation is bypassed but Color EQ is active,
         // we process at the native sample rate (NO oversampling).
@@ -1322,23 +2413,35 @@ private:
                 sat_proc_buf.copyFrom(ch, 0, io, ch, 0, nS);
             }
 
-            const bool eq_tone_active = (std::abs(p_sat_tone) > 0.01f);
-            const bool eq_girth_active = (std::abs(p_girth) > 0.01f);
+            // Stages at their 0 dB (identity) design are elided; see primeColorEq()
+            // (every channel shares the design, so the first speaks for all)
+            const bool eq_bump_active = !sat_ch[0].girth_bump.isIdentity();
+            const bool eq_dip_active = !sat_ch[0].girth_dip.isIdentity();
+            const bool eq_tone_active = !sat_ch[0].tone.isIdentity();
 
             for (int ch = 0; ch < nCh; ++ch)
             {
+                if (ch == lfe_channel)
+                    continue;
+
                 float* y = sat_proc_buf.getWritePointer(ch);
-                auto& tone = (ch == 0) ? sat_tone_l : sat_tone_r;
-                auto& gBump = (ch == 0) ? girth_bump_l : girth_bump_r;
-                auto& gDip = (ch == 0) ? girth_dip_l : girth_dip_r;
+                auto& tone = sat_ch[(size_t)ch].tone;
+                auto& gBump = sat_ch[(size_t)ch].girth_bump;
+                auto& gDip = sat_ch[(size_t)ch].girth_dip;
 
-                for (int i = 0; i < nS; ++i)
+                if (eq_bump_active || eq_dip_active || eq_tone_active)
                 {
-                    double s = (double)y[i];
-                    if (eq_girth_active) { s = gBump.process(s); s = gDip.process(s); }
-                    if (eq_tone_active) { s = tone.process(s); }
-                    y[i] = (float)s;
+                    for (int i = 0; i < nS; ++i)
+                    {
+                        double s = (double)y[i];
+                        if (eq_bump_active) s = gBump.process(s);
+                        if (eq_dip_active) s = gDip.process(s);
+                        if (eq_tone_active) s = tone.process(s);
+                        y[i] = (float)s;
+                    }
                 }
+
+                primeColorEq(ch, y, nS);
             }
 
             // Smooth mix to avoid zipper noise during automation.
@@ -1366,13 +2469,10 @@ private:
         for (int ch = 0; ch < nCh; ++ch)
             sat_clean_buf.copyFrom(ch, 0, io, ch, 0, nS);
 
-        // Align Dry buffer with Oversampling latency
+        // Align Dry buffer with Oversampling latency (phase-matched while Mix blends it back in)
         if (p_active_sat) {
-            float latency = os->getLatencyInSamples();
-            satInternalDelay.setDelay(latency);
-            juce::dsp::AudioBlock<float> block(sat_clean_buf);
-            juce::dsp::ProcessContextReplacing<float> context(block);
-            satInternalDelay.process(context);
+            const bool cleanHeard = sat_mix_target < 1.0 || (float)juce::jlimit(0.0, 1.0, sat_mix_sm) < 1.0f;
+            sat_align.process(sat_clean_buf.getArrayOfWritePointers(), nCh, nS, cleanHeard);
         }
 
         sat_proc_buf.setSize(nCh, nS, false, false, true);
@@ -1385,6 +2485,7 @@ private:
         const float pre_gain = (float)sat_pre_lin_sm;
         if (p_active_sat) {
             for (int ch = 0; ch < nCh; ++ch) {
+                if (ch == lfe_channel) continue;
                 float* x = sat_proc_buf.getWritePointer(ch);
                 for (int i = 0; i < nS; ++i) x[i] *= pre_gain;
             }
@@ -1393,22 +2494,31 @@ private:
         // REMOVED: SC Filters for Sat (p_sc_to_sat functionality)
 
         // --- OVERSAMPLED PROCESSING ---
-        auto block = juce::dsp::AudioBlock<float>(sat_proc_buf);
+        // (the LFE is not oversampled; see saturationChannels)
+        auto block = saturationChannels(sat_proc_buf);
         auto osBlock = os->processSamplesUp(block);
         const int mode = p_sat_mode;
         const double drive = (double)sat_drive_lin_sm;
         const int osN = (int)osBlock.getNumSamples();
-        const bool eq_tone_active = p_active_eq && (std::abs(p_sat_tone) > 0.01f);
-        const bool eq_bright_active = p_active_eq && (std::abs(p_harm_bright) > 0.01f);
-        const bool eq_girth_active = p_active_eq && (std::abs(p_girth) > 0.01f);
+        const auto& design = sat_ch[0];
+        const bool eq_tone_active = p_active_eq && !design.tone.isIdentity();
+        const bool eq_bright_active = p_active_eq && !(design.harm_pre.isIdentity() && design.harm_post.isIdentity());
+        const bool eq_bump_active = p_active_eq && !design.girth_bump.isIdentity();
+        const bool eq_dip_active = p_active_eq && !design.girth_dip.isIdentity();
 
-        for (int ch = 0; ch < nCh; ++ch)
+        for (int j = 0; j < (int)osBlock.getNumChannels(); ++j)
         {
-            float* data = osBlock.getChannelPointer(ch);
-            auto& pre = (ch == 0) ? harm_pre_l : harm_pre_r;
-            auto& post = (ch == 0) ? harm_post_l : harm_post_r;
-            double& phi = (ch == 0) ? steel_phi_l : steel_phi_r;
-            double& yPrev = (ch == 0) ? steel_prev_x_l : steel_prev_x_r;
+            float* data = osBlock.getChannelPointer((size_t)j);
+            auto& c = sat_ch[(size_t)(lfe_channel >= 0 && j >= lfe_channel ? j + 1 : j)];
+            auto& pre = c.harm_pre;
+            auto& post = c.harm_post;
+            double& phi = c.steel_phi;
+            double& yPrev = c.steel_prev_x;
+
+            // The Harm shelves sit either side of the nonlinearity, so an elided pair is primed
+            // from the oversampled input (pre) and output (post) history.
+            const double in1 = osN > 0 ? (double)data[osN - 1] : 0.0;
+            const double in2 = osN > 1 ? (double)data[osN - 2] : 0.0;
 
             for (int i = 0; i < osN; ++i)
             {
@@ -1439,6 +2549,14 @@ private:
                 if (eq_bright_active) s = post.process(s);
                 data[i] = (float)s;
             }
+
+            if (!eq_bright_active && osN > 0)
+            {
+                SimpleBiquad* const pre_chain[] = { &pre };
+                SimpleBiquad* const post_chain[] = { &post };
+                SimpleBiquad::primeElidedStages(pre_chain, 1, in1, in2, osN);
+                SimpleBiquad::primeElidedStages(post_chain, 1, (double)data[osN - 1], osN > 1 ? (double)data[osN - 2] : 0.0, osN);
+            }
         }
         os->processSamplesDown(block);
 
@@ -1449,6 +2567,7 @@ private:
         // so that the AutoGain sees the 'final' level relative to input.
         if (p_active_sat && p_sat_mirror) {
             for (int ch = 0; ch < nCh; ++ch) {
+                if (ch == lfe_channel) continue;
                 float* y = sat_proc_buf.getWritePointer(ch);
                 for (int i = 0; i < nS; ++i) y[i] *= (float)mirror_comp;
             }
@@ -1460,13 +2579,17 @@ private:
 
         for (int ch = 0; ch < nCh; ++ch)
         {
+            if (ch == lfe_channel)
+                continue;
+
             float* y = sat_proc_buf.getWritePointer(ch);
-            auto& ironV = (ch == 0) ? iron_voicing_l : iron_voicing_r;
-            auto& stLo = (ch == 0) ? steel_low_l : steel_low_r;
-            auto& stHi = (ch == 0) ? steel_high_l : steel_high_r;
-            auto& tone = (ch == 0) ? sat_tone_l : sat_tone_r;
-            auto& gBump = (ch == 0) ? girth_bump_l : girth_bump_r;
-            auto& gDip = (ch == 0) ? girth_dip_l : girth_dip_r;
+            auto& c = sat_ch[(size_t)ch];
+            auto& ironV = c.iron_voicing;
+            auto& stLo = c.steel_low;
+            auto& stHi = c.steel_high;
+            auto& tone = c.tone;
+            auto& gBump = c.girth_bump;
+            auto& gDip = c.girth_dip;
 
             for (int i = 0; i < nS; ++i)
             {
@@ -1479,13 +2602,17 @@ private:
                 }
 
                 // Color EQ
-                if (eq_girth_active) { s = gBump.process(s); s = gDip.process(s); }
-                if (eq_tone_active)  s = tone.process(s);
+                if (eq_bump_active) s = gBump.process(s);
+                if (eq_dip_active)  s = gDip.process(s);
+                if (eq_tone_active) s = tone.process(s);
 
                 y[i] = (float)s;
 
                 if (sat_agc_active) outPow_post += s * s;
             }
+
+            if (p_active_eq)
+                primeColorEq(ch, y, nS);
         }
 
         // --- SATURATION AUTO-GAIN (Measured post-voicing/EQ, pre-trim) ---
@@ -1497,6 +2624,7 @@ private:
                 // Measure Clean (Delayed)
                 double inPow = 0.0;
                 for (int ch = 0; ch < nCh; ++ch) {
+                    if (ch == lfe_channel) continue;
                     const float* x = sat_clean_buf.getReadPointer(ch);
                     for (int i = 0; i < nS; ++i) inPow += (double)x[i] * (double)x[i];
                 }
@@ -1510,6 +2638,7 @@ private:
 
                     const float gSm = (float)sat_agc_gain_sm;
                     for (int ch = 0; ch < nCh; ++ch) {
+                        if (ch == lfe_channel) continue;
                         float* y = sat_proc_buf.getWritePointer(ch);
                         for (int i = 0; i < nS; ++i) y[i] *= gSm;
                     }
@@ -1529,6 +2658,7 @@ private:
         if (p_active_sat)
         {
             for (int ch = 0; ch < nCh; ++ch) {
+                if (ch == lfe_channel) continue;
                 float* y = sat_proc_buf.getWritePointer(ch);
                 for (int i = 0; i < nS; ++i) y[i] *= (float)trim;
             }
@@ -1538,6 +2668,10 @@ private:
         sat_mix_sm = smooth1p(sat_mix_sm, sat_mix_target, smooth_alpha_block);
         const float satMix01 = (float)juce::jlimit(0.0, 1.0, sat_mix_sm);
 
+        // The LFE passes through clean, delayed to stay aligned with the oversampled channels
+        if (lfe_channel >= 0 && lfe_channel < nCh)
+            sat_proc_buf.copyFrom(lfe_channel, 0, sat_clean_buf, lfe_channel, 0, nS);
+
         // Apply block back to io if either Saturation or EQ is active.
         if (p_active_sat || p_active_eq)
         {
@@ -1556,40 +2690,66 @@ private:
     int max_block = 512;
     int os_latency_samples = 0; // Oversampling latency (samples)
 
-    std::unique_ptr<juce::dsp::Oversampling<float>> os;
-    std::unique_ptr<juce::dsp::Oversampling<float>> os_dry;
+    // The running Quality mode's oversampler (see QUALITY MODES); os points into it
+    std::unique_ptr<OversamplingPath> os_path;
+    OversamplingStage os_stage;
+    juce::dsp::Oversampling<float>* os = nullptr;
+    int active_quality_mode = -1;
 
     int os_stages = 2;
     int os_factor = 4;
     double os_srate = 176400.0;
 
-    juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Thiran> satInternalDelay{ 8192 };
+    // Latency alignment (see LATENCY ALIGNMENT)
+    LatencyAligner dry_align;      // global dry / Mojo source
+    LatencyAligner sat_align;      // Saturation's clean copy (Mix, auto-gain reference)
+    LatencyAligner audition_align; // SC Audition feed, timing only
 
     // Filters (Comp)
     SimpleBiquad sc_hp_l, sc_hp_r, sc_hp_l_2, sc_hp_r_2;
     SimpleBiquad sc_lp_l, sc_lp_r, sc_lp_l_2, sc_lp_r_2;
 
     SimpleBiquad sc_shelf_l, sc_shelf_r;
-    SimpleBiquad sat_tone_l, sat_tone_r;
-    SimpleBiquad girth_bump_l, girth_bump_r, girth_dip_l, girth_dip_r;
-    SimpleBiquad harm_pre_l, harm_pre_r, harm_post_l, harm_post_r;
-    SimpleBiquad iron_voicing_l, iron_voicing_r, steel_low_l, steel_low_r, steel_high_l, steel_high_r;
+
+    // Saturation / Color EQ state, one entry per bus channel (see prepare)
+    struct SatChannel
+    {
+        SimpleBiquad tone, girth_bump, girth_dip, harm_pre, harm_post;
+        SimpleBiquad iron_voicing, steel_low, steel_high;
+        double steel_phi = 0.0, steel_prev_x = 0.0;
+
+        void resetState() noexcept
+        {
+            tone.resetState(); girth_bump.resetState(); girth_dip.resetState();
+            harm_pre.resetState(); harm_post.resetState();
+            iron_voicing.resetState(); steel_low.resetState(); steel_high.resetState();
+            steel_phi = steel_prev_x = 0.0;
+        }
+    };
+    std::vector<SatChannel> sat_ch;
 
     double fb_prev_l = 0.0, fb_prev_r = 0.0;
     double det_env = 0.0, env = 0.0;
-    double env_l = 0.0, env_r = 0.0;
     double env_fast = 0.0, env_slow = 0.0;
-    double env_fast_l = 0.0, env_fast_r = 0.0;
-    double env_slow_l = 0.0, env_slow_r = 0.0;
-    double att_coeff = 0.999, rel_coeff_manual = 0.999, rel_coeff = 0.999, auto_rel_slow = 0.999, auto_rel_fast = 0.90;
+    // Per-channel stereo detector state (lane 0 = left, lane 1 = right)
+    Double2 env_lr = Double2::broadcast(0.0), env_fast_lr = Double2::broadcast(0.0), env_slow_lr = Double2::broadcast(0.0);
+    double att_coeff = 0.999, rel_coeff_manual = 0.999, auto_rel_slow = 0.999, auto_rel_fast = 0.90;
+
+    // Multirate detector (det_decimation > 1): current partial step and the gains being interpolated.
+    int det_decimation = 1;
+    double det_rate = 44100.0;
+    double flux_decay = 0.995;
+    int cr_phase = 0;
+    Double2 cr_acc_lr = Double2::broadcast(0.0);
+    Double2 cr_gain_prev_lr = Double2::broadcast(1.0), cr_gain_cur_lr = Double2::broadcast(1.0);
 
     bool use_rms = false;
     int rms_window = 1;
     int rms_window_max = 1;
-    std::vector<double> rms_ring_l;
-    std::vector<double> rms_ring_r;
+    std::vector<float> rms_ring; // interleaved L/R power
     int rms_pos = 0;
-    double rms_sum_l = 0.0, rms_sum_r = 0.0;
+    Double2 rms_sum_lr = Double2::broadcast(0.0);
+    Double2 rms_lap_lr = Double2::broadcast(0.0); // sum of the powers written since rms_pos last wrapped
     double stereo_link = 1.0;
     double fb_blend = 0.0;
 
@@ -1601,6 +2761,14 @@ private:
     double cf_amt = 0.0;
     double cf_ratio_mix = 0.0;
 
+    // Control layer between evaluations: per-step accumulators and the offsets being interpolated.
+    int cl_interval = 1, cl_phase = 0;
+    double cl_inv_interval = 1.0, cl_flux_decay = 0.995;
+    double cl_tp_avg_peak = 0.0, cl_flux_peak = 0.0;
+    double cl_thresh_prev = 0.0, cl_thresh_cur = 0.0;
+    double cl_ratio_prev = 1.0, cl_ratio_cur = 1.0;
+    double cl_scale_prev = 1.0, cl_scale_cur = 1.0;
+
     bool tp_enabled = false;
     double tp_amt = 0.5;
     double tp_raise_db = 12.0;
@@ -1608,8 +2776,6 @@ private:
     double flux_amt = 0.3;
     double flux_env = 0.0;
 
-    double steel_phi_l = 0.0, steel_phi_r = 0.0;
-    double steel_prev_x_l = 0.0, steel_prev_x_r = 0.0;
     double steel_dt = 0.0, steel_dy_gain = 1.0, steel_leak_coeff = 1.0;
 
     // Gain States
@@ -1643,6 +2809,7 @@ private:
     double drywet_sm = 1.0;
 
     double smooth_alpha = 0.999, smooth_alpha_block = 0.999, smooth_alpha_os = 0.999;
+    int smooth_alpha_block_len = -1;
     double thresh_sm = -20.0, ratio_sm = 4.0, knee_sm = 6.0;
 
     int last_sat_mode = -1;
@@ -1658,6 +2825,7 @@ private:
     int  prevTopoMsMode = 0;
     int  prevTopoScMode = 0;
     bool prevTopoScToComp = false;
+    int  prevTopoLookahead = 0;
 
     // ----------------------------------------------------------------------
     // MOJO: Calibrated parallel "analog magic" (single-button)
@@ -1668,7 +2836,14 @@ private:
     double mojo_mix_sm = 0.5; // Smooth variable blend
     double mojo_mix_target = 0.5;
     double mojo_env = 0.0;
-    double mojo_level_sm = 1.0;
+    double mojo_level_sm = 1.0, mojo_level_target = 1.0;
+
+    float in_gain_lin = 1.0f;
+    MixBusSimd::LevelAccumulator input_level[2];
+    MixBusSimd::LevelAccumulator output_level[2];
+    double gr_block_lo = 0.0, gr_block_hi = 0.0;
+
+    int outputMeterChannel(int channel) const noexcept { return (output_level[1].numSamples > 0) ? (channel & 1) : 0; }
 
     SimpleBiquad mojo_hp_l, mojo_hp_r;
     SimpleBiquad mojo_low_shelf_l, mojo_low_shelf_r;
@@ -1680,5 +2855,22 @@ private:
     double mojo_dc_x1_r = 0.0, mojo_dc_y1_r = 0.0;
 
     juce::AudioBuffer<float> dry_buf, wet_buf, sc_internal_buf, mojo_buf;
+    std::vector<double> sc_det_l, sc_det_r; // conditioned detector feed (see conditionSidechain)
     juce::AudioBuffer<float> sat_clean_buf, sat_proc_buf;
+
+    // Surround bed: the bus channels after the front pair (see SURROUND BED)
+    int num_channels = 2;
+    int lfe_channel = -1;
+    struct ScBedChannel { SimpleBiquad hp, hp_2, lp, lp_2, shelf; };
+    std::vector<ScBedChannel> sc_bed;          // even count: an odd bed gets a silent partner lane
+    bool sc_external_live = false;             // this chunk has an external key (External mode and a connected bus)
+    std::vector<double> sc_bed_buf;            // one lane pair of conditioning scratch
+    std::vector<double> sc_det_bed, bed_gain;  // folded bed detector feed, linked bed gain
+    std::vector<float*> sat_os_channels;       // the channels the Saturation oversampler runs
+
+    // Lookahead (see LOOKAHEAD)
+    int la_max_samples = 0;
+    int la_samples = 0;
+    SlidingWindowMax la_det_l, la_det_r, la_det_bed;
+    LookaheadDelay la_wet, la_dry;
 };
\ No newline at end of file